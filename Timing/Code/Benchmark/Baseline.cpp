@@ -0,0 +1,323 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Benchmark/Baseline.hpp>
+// Median, MedianAbsoluteDeviation, MannWhitneyUTest
+#include <Benchmark/Statistics.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// find_if, max
+#include <algorithm>
+// size_t
+#include <cstddef>
+// setprecision, setw
+#include <iomanip>
+// istream
+#include <istream>
+// numeric_limits
+#include <limits>
+// ostream
+#include <ostream>
+// istringstream
+#include <sstream>
+// string_view
+#include <string_view>
+// move
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The magic identifying baselines.
+		 */
+		constexpr std::string_view g_baseline_magic = "mage-benchmark-baseline";
+
+		/**
+		 The version of baselines.
+		 */
+		constexpr unsigned int g_baseline_version = 1u;
+
+		/**
+		 Writes the given samples as a record with the given key to the given
+		 output stream.
+
+		 @param[in,out]	stream
+						A reference to the output stream.
+		 @param[in]		key
+						The key of the record.
+		 @param[in]		samples
+						A reference to the samples.
+		 */
+		void WriteSamples(std::ostream& stream, std::string_view key,
+						  const std::vector< F64 >& samples)
+		{
+			stream << key << ' ' << samples.size();
+			for (const auto sample : samples)
+			{
+				stream << ' ' << sample;
+			}
+			stream << '\n';
+		}
+
+		/**
+		 Reads the samples of a record with the given key from the given
+		 input stream.
+
+		 @param[in,out]	stream
+						A reference to the input stream.
+		 @param[in]		key
+						The key of the record.
+		 @param[out]	samples
+						A reference to the samples.
+		 @return		@c true if the samples were read successfully.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool ReadSamples(std::istream& stream, std::string_view key,
+						 std::vector< F64 >& samples)
+		{
+			std::string line;
+			if (!std::getline(stream, line))
+			{
+				return false;
+			}
+
+			std::istringstream record(line);
+			std::string record_key;
+			std::size_t count = 0u;
+			if (!(record >> record_key >> count) || key != record_key)
+			{
+				return false;
+			}
+
+			// The count is not trusted to size the samples (e.g., a corrupt
+			// count must not exhaust the memory), only to validate them.
+			samples.clear();
+			for (F64 sample = 0.0; record >> sample; )
+			{
+				samples.push_back(sample);
+			}
+
+			return count == samples.size();
+		}
+
+		/**
+		 Recomputes the summary statistics of the given benchmark result
+		 from all its samples.
+
+		 @param[in,out]	result
+						A reference to the benchmark result.
+		 */
+		void Summarize(BenchmarkResult& result)
+		{
+			result.m_wall_median = Median(result.m_wall_times);
+			result.m_wall_mad    = MedianAbsoluteDeviation(result.m_wall_times);
+			result.m_cpu_median  = Median(result.m_cpu_times);
+			result.m_cpu_mad     = MedianAbsoluteDeviation(result.m_cpu_times);
+			result.m_efficiency  = (0.0 < result.m_wall_median)
+								 ? result.m_cpu_median / result.m_wall_median
+								 : 0.0;
+		}
+
+		/**
+		 Returns the compared samples of the given benchmark result.
+
+		 @param[in]		result
+						A reference to the benchmark result.
+		 @param[in]		options
+						A reference to the regression detection options.
+		 @return		A reference to the compared samples of the given
+						benchmark result.
+		 */
+		[[nodiscard]]
+		const std::vector< F64 >& GetSamples(const BenchmarkResult& result,
+											 const RegressionOptions& options)
+			noexcept
+		{
+			return options.m_use_cpu_time ? result.m_cpu_times
+										  : result.m_wall_times;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Benchmark Baselines
+	//-------------------------------------------------------------------------
+
+	void WriteBaseline(std::ostream& stream,
+					   const std::vector< BenchmarkResult >& results)
+	{
+		const auto precision = stream.precision();
+		stream << std::setprecision(17);
+
+		stream << g_baseline_magic << ' ' << g_baseline_version << '\n';
+		for (const auto& result : results)
+		{
+			stream << "benchmark " << result.m_name << '\n';
+			stream << "iterations " << result.m_iteration_count << '\n';
+			WriteSamples(stream, "wall", result.m_wall_times);
+			WriteSamples(stream, "cpu",  result.m_cpu_times);
+		}
+
+		stream.precision(precision);
+	}
+
+	[[nodiscard]]
+	bool ReadBaseline(std::istream& stream,
+					  std::vector< BenchmarkResult >& results)
+	{
+		results.clear();
+
+		std::string magic;
+		unsigned int version = 0u;
+		if (!(stream >> magic >> version)
+			|| g_baseline_magic != magic
+			|| g_baseline_version != version)
+		{
+			return false;
+		}
+		stream.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+
+		constexpr std::string_view benchmark_key = "benchmark ";
+
+		std::string line;
+		while (std::getline(stream, line))
+		{
+			if (line.empty())
+			{
+				continue;
+			}
+
+			if (0u != line.compare(0u, benchmark_key.size(), benchmark_key))
+			{
+				return false;
+			}
+
+			BenchmarkResult result;
+			result.m_name = line.substr(benchmark_key.size());
+
+			std::string key;
+			if (!(stream >> key >> result.m_iteration_count)
+				|| "iterations" != key)
+			{
+				return false;
+			}
+			stream.ignore(std::numeric_limits< std::streamsize >::max(),
+						  '\n');
+
+			if (!ReadSamples(stream, "wall", result.m_wall_times)
+				|| !ReadSamples(stream, "cpu",  result.m_cpu_times))
+			{
+				return false;
+			}
+
+			Summarize(result);
+			results.push_back(std::move(result));
+		}
+
+		return true;
+	}
+
+	//-------------------------------------------------------------------------
+	// Regression Detection
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	std::vector< BenchmarkComparison >
+		CompareBenchmarks(const std::vector< BenchmarkResult >& baseline,
+						  const std::vector< BenchmarkResult >& results,
+						  const RegressionOptions& options)
+	{
+		std::vector< BenchmarkComparison > comparisons;
+
+		for (const auto& result : results)
+		{
+			const auto it = std::find_if(baseline.cbegin(), baseline.cend(),
+				[&result](const BenchmarkResult& baseline_result)
+				{
+					return baseline_result.m_name == result.m_name;
+				});
+			if (baseline.cend() == it)
+			{
+				continue;
+			}
+
+			const auto& baseline_samples = GetSamples(*it, options);
+			const auto& current_samples  = GetSamples(result, options);
+
+			BenchmarkComparison comparison;
+			comparison.m_name            = result.m_name;
+			comparison.m_baseline_median = Median(baseline_samples);
+			comparison.m_current_median  = Median(current_samples);
+			comparison.m_change = (0.0 < comparison.m_baseline_median)
+				? comparison.m_current_median / comparison.m_baseline_median
+				  - 1.0
+				: 0.0;
+
+			// Tests whether the current samples tend to be slower.
+			const auto test = MannWhitneyUTest(current_samples,
+											   baseline_samples);
+			comparison.m_p_value     = test.m_p_value;
+			comparison.m_effect_size = test.m_effect_size;
+			comparison.m_regression
+				= (1.0 - options.m_confidence) > test.m_p_value
+				&& options.m_threshold < comparison.m_change;
+
+			comparisons.push_back(std::move(comparison));
+		}
+
+		return comparisons;
+	}
+
+	void WriteComparisonReport(
+		std::ostream& stream,
+		const std::vector< BenchmarkComparison >& comparisons)
+	{
+		std::size_t name_width = 9u;
+		for (const auto& comparison : comparisons)
+		{
+			name_width = std::max(name_width, comparison.m_name.size());
+		}
+
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << std::left  << std::setw(static_cast< int >(name_width))
+			   << "Benchmark"
+			   << std::right << std::setw(16) << "Baseline (ns)"
+			   << std::setw(16) << "Current (ns)"
+			   << std::setw(10) << "Change"
+			   << std::setw(10) << "p-value"
+			   << std::setw(10) << "Effect"
+			   << std::setw(12) << "Verdict" << '\n';
+
+		stream << std::fixed;
+		for (const auto& comparison : comparisons)
+		{
+			stream << std::left  << std::setw(static_cast< int >(name_width))
+				   << comparison.m_name
+				   << std::right << std::setprecision(2)
+				   << std::setw(16) << 1e9 * comparison.m_baseline_median
+				   << std::setw(16) << 1e9 * comparison.m_current_median
+				   << std::setw(9)  << 100.0 * comparison.m_change << '%'
+				   << std::setprecision(4)
+				   << std::setw(10) << comparison.m_p_value
+				   << std::setprecision(2)
+				   << std::setw(10) << comparison.m_effect_size
+				   << std::setw(12)
+				   << (comparison.m_regression ? "REGRESSION" : "ok") << '\n';
+		}
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// BenchmarkResult
+#include <Benchmark/Benchmark.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// istream, ostream
+#include <iosfwd>
+// string
+#include <string>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Benchmark Baselines
+	//-------------------------------------------------------------------------
+
+	/**
+	 Writes the given benchmark results as a baseline to the given output
+	 stream.
+
+	 The baseline is a versioned text format storing the name, the number of
+	 iterations and all wall clock and CPU time samples of each benchmark,
+	 so later runs can be compared against the full distributions instead of
+	 summary statistics only.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		results
+					A reference to the benchmark results.
+	 */
+	void WriteBaseline(std::ostream& stream,
+					   const std::vector< BenchmarkResult >& results);
+
+	/**
+	 Reads benchmark results from the given baseline input stream.
+
+	 The medians, median absolute deviations and efficiencies of the read
+	 benchmark results are recomputed from all samples.
+
+	 @param[in,out]	stream
+					A reference to the input stream.
+	 @param[out]	results
+					A reference to the benchmark results.
+	 @return		@c true if the baseline was read successfully. @c false
+					otherwise.
+	 @note			Fails on a missing header, an unsupported version or a
+					malformed record.
+	 */
+	[[nodiscard]]
+	bool ReadBaseline(std::istream& stream,
+					  std::vector< BenchmarkResult >& results);
+
+	//-------------------------------------------------------------------------
+	// Regression Detection
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of regression detection options.
+	 */
+	struct RegressionOptions
+	{
+		/**
+		 The threshold (i.e. the relative slowdown of the median time, e.g.
+		 0.05 for 5%) above which a significant slowdown is a regression.
+		 */
+		F64 m_threshold = 0.05;
+
+		/**
+		 The confidence level (e.g. 0.95) at which a slowdown must be
+		 significant to be a regression.
+		 */
+		F64 m_confidence = 0.95;
+
+		/**
+		 Flag indicating whether the CPU times instead of the wall clock
+		 times are compared.
+		 */
+		bool m_use_cpu_time = false;
+	};
+
+	/**
+	 A struct of comparisons of a benchmark against its baseline.
+	 */
+	struct BenchmarkComparison
+	{
+		/**
+		 The name of the benchmark.
+		 */
+		std::string m_name;
+
+		/**
+		 The median time (in seconds per iteration) of the baseline.
+		 */
+		F64 m_baseline_median = 0.0;
+
+		/**
+		 The median time (in seconds per iteration) of the current run.
+		 */
+		F64 m_current_median = 0.0;
+
+		/**
+		 The relative change of the median time (e.g. 0.1 for a 10%
+		 slowdown and -0.1 for a 10% speedup).
+		 */
+		F64 m_change = 0.0;
+
+		/**
+		 The one-sided p-value of the current run being slower than the
+		 baseline (see @c MannWhitneyUTest).
+		 */
+		F64 m_p_value = 1.0;
+
+		/**
+		 The effect size (i.e. the probability that a current sample is
+		 slower than a baseline sample, with 0.5 indicating no effect).
+		 */
+		F64 m_effect_size = 0.5;
+
+		/**
+		 Flag indicating whether the benchmark regressed.
+		 */
+		bool m_regression = false;
+	};
+
+	/**
+	 Compares the given benchmark results against the given baseline.
+
+	 A benchmark regresses if its current samples are significantly slower
+	 than its baseline samples according to a one-sided Mann-Whitney U test
+	 at the configured confidence level, and its median slowed down beyond
+	 the configured threshold. Benchmarks without baseline are ignored.
+
+	 @param[in]		baseline
+					A reference to the baseline benchmark results.
+	 @param[in]		results
+					A reference to the current benchmark results.
+	 @param[in]		options
+					A reference to the regression detection options.
+	 @return		The comparisons of the benchmarks present in both the
+					baseline and the current benchmark results.
+	 */
+	[[nodiscard]]
+	std::vector< BenchmarkComparison >
+		CompareBenchmarks(const std::vector< BenchmarkResult >& baseline,
+						  const std::vector< BenchmarkResult >& results,
+						  const RegressionOptions& options);
+
+	/**
+	 Writes the given benchmark comparisons as a table to the given output
+	 stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		comparisons
+					A reference to the benchmark comparisons.
+	 */
+	void WriteComparisonReport(
+		std::ostream& stream,
+		const std::vector< BenchmarkComparison >& comparisons);
+}
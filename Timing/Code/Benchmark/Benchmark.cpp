@@ -0,0 +1,366 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Benchmark/Benchmark.hpp>
+// DetectOutliers, Median, MedianAbsoluteDeviation
+#include <Benchmark/Statistics.hpp>
+// WriteJsonString
+#include <IO/Json.hpp>
+// WallCpuTimer
+#include <System/MultiTimer.hpp>
+// TimeIntervalSeconds
+#include <System/Timer.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// clamp, max, min
+#include <algorithm>
+// ceil, floor
+#include <cmath>
+// setprecision, setw
+#include <iomanip>
+// ostream
+#include <ostream>
+// move
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		//---------------------------------------------------------------------
+		// Registry
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of registered benchmarks.
+		 */
+		struct RegisteredBenchmark
+		{
+			/**
+			 The name of this registered benchmark.
+			 */
+			std::string m_name;
+
+			/**
+			 The function of this registered benchmark.
+			 */
+			BenchmarkFunction m_function;
+		};
+
+		/**
+		 Returns the registered benchmarks.
+
+		 @return		A reference to the registered benchmarks.
+		 */
+		[[nodiscard]]
+		std::vector< RegisteredBenchmark >& GetRegisteredBenchmarks()
+		{
+			// Function-local to be safe during static initialization.
+			static std::vector< RegisteredBenchmark > s_benchmarks;
+			return s_benchmarks;
+		}
+
+		//---------------------------------------------------------------------
+		// Measurement
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of measurements of one repetition.
+		 */
+		struct Measurement
+		{
+			/**
+			 The wall clock time (in seconds) of this measurement.
+			 */
+			F64 m_wall_time;
+
+			/**
+			 The CPU time (in seconds) of this measurement.
+			 */
+			F64 m_cpu_time;
+		};
+
+		/**
+		 Measures the given benchmark function for the given number of
+		 iterations.
+
+		 @param[in]		function
+						A reference to the benchmark function.
+		 @param[in]		iteration_count
+						The number of iterations.
+		 @return		The measurement.
+		 */
+		[[nodiscard]]
+		Measurement Measure(const BenchmarkFunction& function,
+							U64 iteration_count)
+		{
+			WallCpuTimer timer;
+
+			ClobberMemory();
+			timer.Start();
+
+			function(iteration_count);
+
+			ClobberMemory();
+			const auto [wall_time, cpu_time]
+				= timer.DeltaTime< TimeIntervalSeconds >();
+
+			return { wall_time.count(), cpu_time.count() };
+		}
+
+		/**
+		 Determines the number of iterations of the given benchmark function
+		 to fill the given time budget.
+
+		 @param[in]		function
+						A reference to the benchmark function.
+		 @param[in]		min_time
+						The time budget (in seconds).
+		 @param[in]		max_iteration_count
+						The maximum number of iterations.
+		 @param[in]		iteration_count
+						The initial number of iterations.
+		 @return		The number of iterations.
+		 */
+		[[nodiscard]]
+		U64 ScaleIterationCount(const BenchmarkFunction& function,
+								F64 min_time,
+								U64 max_iteration_count,
+								U64 iteration_count = 1u)
+		{
+			iteration_count = std::clamp(iteration_count, U64(1u),
+										 std::max(max_iteration_count,
+												  U64(1u)));
+			while (iteration_count < max_iteration_count)
+			{
+				const auto wall_time
+					= Measure(function, iteration_count).m_wall_time;
+				if (min_time <= wall_time)
+				{
+					break;
+				}
+
+				// Aim 40% above the budget to converge in few rounds, but
+				// grow at least 2x and at most 10x per round.
+				const auto factor = (0.0 < wall_time)
+					? std::clamp(1.4 * min_time / wall_time, 2.0, 10.0) : 10.0;
+				const auto next = static_cast< U64 >(std::ceil(
+					factor * static_cast< F64 >(iteration_count)));
+				iteration_count = std::min(next, max_iteration_count);
+			}
+
+			return iteration_count;
+		}
+
+		/**
+		 Converts the given time (in seconds) to a time per iteration (in
+		 nanoseconds).
+
+		 @param[in]		time
+						The time (in seconds per iteration).
+		 @return		The time in nanoseconds per iteration.
+		 */
+		[[nodiscard]]
+		constexpr F64 ToNanoseconds(F64 time) noexcept
+		{
+			return 1e9 * time;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Benchmark Registration
+	//-------------------------------------------------------------------------
+
+	bool RegisterBenchmark(std::string name, BenchmarkFunction function)
+	{
+		GetRegisteredBenchmarks().push_back({ std::move(name),
+											  std::move(function) });
+		return true;
+	}
+
+	//-------------------------------------------------------------------------
+	// Benchmark Execution
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	BenchmarkResult RunBenchmark(std::string name,
+								 const BenchmarkFunction& function,
+								 const BenchmarkOptions& options)
+	{
+		BenchmarkResult result;
+		result.m_name = std::move(name);
+
+		// Warmup (caches, branch predictors, frequency scaling), which also
+		// serves as a first estimate of the number of iterations.
+		const auto warmup_iteration_count = ScaleIterationCount(
+			function, options.m_warmup_time, options.m_max_iteration_count);
+		const auto estimated_iteration_count = (0.0 < options.m_warmup_time)
+			? std::floor(static_cast< F64 >(warmup_iteration_count)
+						 * options.m_min_time / options.m_warmup_time)
+			: 1.0;
+
+		const auto iteration_count = ScaleIterationCount(
+			function, options.m_min_time, options.m_max_iteration_count,
+			static_cast< U64 >(std::min(
+				estimated_iteration_count,
+				static_cast< F64 >(options.m_max_iteration_count))));
+		result.m_iteration_count = iteration_count;
+
+		const auto repetition_count
+			= std::max(options.m_repetition_count, std::size_t(1u));
+		const auto inv_iteration_count
+			= 1.0 / static_cast< F64 >(iteration_count);
+		result.m_wall_times.reserve(repetition_count);
+		result.m_cpu_times.reserve(repetition_count);
+		for (std::size_t i = 0u; i < repetition_count; ++i)
+		{
+			const auto measurement = Measure(function, iteration_count);
+			result.m_wall_times.push_back(
+				measurement.m_wall_time * inv_iteration_count);
+			result.m_cpu_times.push_back(
+				measurement.m_cpu_time  * inv_iteration_count);
+		}
+
+		// Reject outliers based on the wall clock time and retain the CPU
+		// times of the same repetitions.
+		const auto outliers = DetectOutliers(result.m_wall_times,
+											 options.m_outlier_threshold);
+		std::vector< F64 > wall_times;
+		std::vector< F64 > cpu_times;
+		for (std::size_t i = 0u; i < repetition_count; ++i)
+		{
+			if (outliers[i])
+			{
+				++result.m_outlier_count;
+				continue;
+			}
+
+			wall_times.push_back(result.m_wall_times[i]);
+			cpu_times.push_back(result.m_cpu_times[i]);
+		}
+
+		result.m_wall_median = Median(wall_times);
+		result.m_wall_mad    = MedianAbsoluteDeviation(wall_times);
+		result.m_cpu_median  = Median(cpu_times);
+		result.m_cpu_mad     = MedianAbsoluteDeviation(cpu_times);
+		result.m_efficiency  = (0.0 < result.m_wall_median)
+							 ? result.m_cpu_median / result.m_wall_median
+							 : 0.0;
+
+		return result;
+	}
+
+	[[nodiscard]]
+	std::vector< BenchmarkResult >
+		RunBenchmarks(const BenchmarkOptions& options,
+					  std::string_view filter)
+	{
+		std::vector< BenchmarkResult > results;
+		for (const auto& benchmark : GetRegisteredBenchmarks())
+		{
+			if (std::string_view::npos == benchmark.m_name.find(filter))
+			{
+				continue;
+			}
+
+			results.push_back(RunBenchmark(benchmark.m_name,
+										   benchmark.m_function,
+										   options));
+		}
+
+		return results;
+	}
+
+	//-------------------------------------------------------------------------
+	// Benchmark Reporting
+	//-------------------------------------------------------------------------
+
+	void WriteConsoleReport(std::ostream& stream,
+							const std::vector< BenchmarkResult >& results)
+	{
+		std::size_t name_width = 9u;
+		for (const auto& result : results)
+		{
+			name_width = std::max(name_width, result.m_name.size());
+		}
+
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << std::left  << std::setw(static_cast< int >(name_width))
+			   << "Benchmark"
+			   << std::right << std::setw(14) << "Iterations"
+			   << std::setw(14) << "Wall (ns)"
+			   << std::setw(12) << "+/- MAD"
+			   << std::setw(14) << "CPU (ns)"
+			   << std::setw(12) << "+/- MAD"
+			   << std::setw(10) << "CPU/Wall"
+			   << std::setw(10) << "Outliers" << '\n';
+
+		stream << std::fixed << std::setprecision(2);
+		for (const auto& result : results)
+		{
+			stream << std::left  << std::setw(static_cast< int >(name_width))
+				   << result.m_name
+				   << std::right << std::setw(14) << result.m_iteration_count
+				   << std::setw(14) << ToNanoseconds(result.m_wall_median)
+				   << std::setw(12) << ToNanoseconds(result.m_wall_mad)
+				   << std::setw(14) << ToNanoseconds(result.m_cpu_median)
+				   << std::setw(12) << ToNanoseconds(result.m_cpu_mad)
+				   << std::setw(10) << result.m_efficiency
+				   << std::setw(10) << result.m_outlier_count << '\n';
+		}
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+
+	void WriteJsonReport(std::ostream& stream,
+						 const std::vector< BenchmarkResult >& results)
+	{
+		const auto write_samples = [&stream](const std::vector< F64 >& samples)
+		{
+			stream << '[';
+			for (std::size_t i = 0u; i < samples.size(); ++i)
+			{
+				stream << (0u == i ? "" : ",") << ToNanoseconds(samples[i]);
+			}
+			stream << ']';
+		};
+
+		const auto precision = stream.precision();
+		stream << std::setprecision(17);
+
+		stream << "{\"unit\":\"ns\",\"benchmarks\":[";
+		for (std::size_t i = 0u; i < results.size(); ++i)
+		{
+			const auto& result = results[i];
+
+			stream << (0u == i ? "\n" : ",\n") << "{\"name\":";
+			WriteJsonString(stream, result.m_name);
+			stream << ",\"iterations\":"  << result.m_iteration_count
+				   << ",\"wall_median\":" << ToNanoseconds(result.m_wall_median)
+				   << ",\"wall_mad\":"    << ToNanoseconds(result.m_wall_mad)
+				   << ",\"cpu_median\":"  << ToNanoseconds(result.m_cpu_median)
+				   << ",\"cpu_mad\":"     << ToNanoseconds(result.m_cpu_mad)
+				   << ",\"cpu_wall_ratio\":" << result.m_efficiency
+				   << ",\"outliers\":"    << result.m_outlier_count
+				   << ",\"wall_samples\":";
+			write_samples(result.m_wall_times);
+			stream << ",\"cpu_samples\":";
+			write_samples(result.m_cpu_times);
+			stream << '}';
+		}
+		stream << "\n]}\n";
+
+		stream.precision(precision);
+	}
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// F64, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// size_t
+#include <cstddef>
+// function
+#include <functional>
+// ostream
+#include <iosfwd>
+// string
+#include <string>
+// string_view
+#include <string_view>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Optimization Barriers
+	//-------------------------------------------------------------------------
+
+	/**
+	 Prevents the compiler from optimizing away the computation of the given
+	 value.
+
+	 @tparam		T
+					The value type.
+	 @param[in]		value
+					A reference to the value.
+	 */
+	template< typename T >
+	void DoNotOptimize(const T& value) noexcept;
+
+	/**
+	 Prevents the compiler from reordering or eliminating memory accesses
+	 across this barrier.
+	 */
+	void ClobberMemory() noexcept;
+
+	//-------------------------------------------------------------------------
+	// Benchmark Registration
+	//-------------------------------------------------------------------------
+
+	/**
+	 A benchmark function type executing the benchmarked code the given
+	 number of iterations.
+	 */
+	using BenchmarkFunction = std::function< void(U64 iteration_count) >;
+
+	/**
+	 Registers a benchmark.
+
+	 @param[in]		name
+					The name of the benchmark.
+	 @param[in]		function
+					The benchmark function.
+	 @return		@c true (to allow registration during static
+					initialization).
+	 */
+	bool RegisterBenchmark(std::string name, BenchmarkFunction function);
+
+	//-------------------------------------------------------------------------
+	// Benchmark Execution
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of benchmark options.
+	 */
+	struct BenchmarkOptions
+	{
+		/**
+		 The minimum wall clock time (in seconds) of a single repetition. The
+		 number of iterations per repetition is scaled to this time budget.
+		 */
+		F64 m_min_time = 0.5;
+
+		/**
+		 The wall clock time (in seconds) of the warmup before the
+		 repetitions.
+		 */
+		F64 m_warmup_time = 0.1;
+
+		/**
+		 The number of repetitions.
+		 */
+		std::size_t m_repetition_count = 10u;
+
+		/**
+		 The maximum number of iterations per repetition.
+		 */
+		U64 m_max_iteration_count = U64(1u) << 40u;
+
+		/**
+		 The outlier threshold (in scaled median absolute deviations from the
+		 median).
+		 */
+		F64 m_outlier_threshold = 3.0;
+	};
+
+	/**
+	 A struct of benchmark results.
+	 */
+	struct BenchmarkResult
+	{
+		/**
+		 The name of the benchmark.
+		 */
+		std::string m_name;
+
+		/**
+		 The number of iterations per repetition.
+		 */
+		U64 m_iteration_count = 0u;
+
+		/**
+		 The wall clock times (in seconds per iteration) of all repetitions.
+		 */
+		std::vector< F64 > m_wall_times;
+
+		/**
+		 The CPU (i.e. core clock per core) times (in seconds per iteration)
+		 of all repetitions.
+		 */
+		std::vector< F64 > m_cpu_times;
+
+		/**
+		 The number of rejected outlier repetitions (based on the wall clock
+		 time).
+		 */
+		std::size_t m_outlier_count = 0u;
+
+		/**
+		 The median wall clock time (in seconds per iteration) of the
+		 retained repetitions.
+		 */
+		F64 m_wall_median = 0.0;
+
+		/**
+		 The median absolute deviation of the wall clock time (in seconds per
+		 iteration) of the retained repetitions.
+		 */
+		F64 m_wall_mad = 0.0;
+
+		/**
+		 The median CPU time (in seconds per iteration) of the retained
+		 repetitions.
+		 */
+		F64 m_cpu_median = 0.0;
+
+		/**
+		 The median absolute deviation of the CPU time (in seconds per
+		 iteration) of the retained repetitions.
+		 */
+		F64 m_cpu_mad = 0.0;
+
+		/**
+		 The ratio of the median CPU time per core to the median wall clock
+		 time (i.e. the parallel efficiency: 1 if all cores are busy during
+		 the whole wall clock time).
+		 */
+		F64 m_efficiency = 0.0;
+	};
+
+	/**
+	 Runs the given benchmark.
+
+	 @param[in]		name
+					The name of the benchmark.
+	 @param[in]		function
+					A reference to the benchmark function.
+	 @param[in]		options
+					A reference to the benchmark options.
+	 @return		The benchmark result.
+	 */
+	[[nodiscard]]
+	BenchmarkResult RunBenchmark(std::string name,
+								 const BenchmarkFunction& function,
+								 const BenchmarkOptions& options);
+
+	/**
+	 Runs the registered benchmarks whose name contains the given filter.
+
+	 @param[in]		options
+					A reference to the benchmark options.
+	 @param[in]		filter
+					The filter.
+	 @return		The benchmark results.
+	 */
+	[[nodiscard]]
+	std::vector< BenchmarkResult >
+		RunBenchmarks(const BenchmarkOptions& options,
+					  std::string_view filter = {});
+
+	//-------------------------------------------------------------------------
+	// Benchmark Reporting
+	//-------------------------------------------------------------------------
+
+	/**
+	 Writes the given benchmark results as a table to the given output
+	 stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		results
+					A reference to the benchmark results.
+	 */
+	void WriteConsoleReport(std::ostream& stream,
+							const std::vector< BenchmarkResult >& results);
+
+	/**
+	 Writes the given benchmark results as JSON to the given output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		results
+					A reference to the benchmark results.
+	 */
+	void WriteJsonReport(std::ostream& stream,
+						 const std::vector< BenchmarkResult >& results);
+}
+
+//-----------------------------------------------------------------------------
+// Defines
+//-----------------------------------------------------------------------------
+
+#define MAGE_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define MAGE_BENCHMARK_CONCAT(a, b) MAGE_BENCHMARK_CONCAT_IMPL(a, b)
+
+/**
+ Registers the given benchmark function (i.e. a function taking the number
+ of iterations) under its own name.
+ */
+#define MAGE_BENCHMARK(function)                                              \
+	[[maybe_unused]]                                                          \
+	static const bool MAGE_BENCHMARK_CONCAT(mage_benchmark_, __LINE__)        \
+		= mage::RegisterBenchmark(#function, function)
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Benchmark/Benchmark.inl>
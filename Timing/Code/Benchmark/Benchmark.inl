@@ -0,0 +1,40 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+// _ReadWriteBarrier
+#include <intrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename T >
+	inline void DoNotOptimize(const T& value) noexcept
+	{
+#ifdef _MSC_VER
+		// MSVC has no inline assembly on x64: escape the address of the value
+		// through a volatile read instead.
+		const volatile char* const escape
+			= reinterpret_cast< const volatile char* >(&value);
+		static_cast< void >(*escape);
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	inline void ClobberMemory() noexcept
+	{
+#ifdef _MSC_VER
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+}
@@ -0,0 +1,166 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Benchmark/Statistics.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max_element, nth_element, sort
+#include <algorithm>
+// abs, erfc, sqrt
+#include <cmath>
+// size_t
+#include <cstddef>
+// move, pair
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The scale factor of the median absolute deviation to estimate the
+		 standard deviation of normally distributed samples.
+		 */
+		constexpr F64 g_mad_scale = 1.4826;
+	}
+
+	[[nodiscard]]
+	F64 Median(std::vector< F64 > samples)
+	{
+		if (samples.empty())
+		{
+			return 0.0;
+		}
+
+		const auto middle = samples.size() / 2u;
+		std::nth_element(samples.begin(), samples.begin() + middle,
+						 samples.end());
+		const auto upper = samples[middle];
+		if (0u != samples.size() % 2u)
+		{
+			return upper;
+		}
+
+		const auto lower = *std::max_element(samples.begin(),
+											 samples.begin() + middle);
+		return 0.5 * (lower + upper);
+	}
+
+	[[nodiscard]]
+	F64 MedianAbsoluteDeviation(const std::vector< F64 >& samples)
+	{
+		const auto median = Median(samples);
+
+		std::vector< F64 > deviations;
+		deviations.reserve(samples.size());
+		for (const auto sample : samples)
+		{
+			deviations.push_back(std::abs(sample - median));
+		}
+
+		return Median(std::move(deviations));
+	}
+
+	[[nodiscard]]
+	std::vector< bool > DetectOutliers(const std::vector< F64 >& samples,
+									   F64 threshold)
+	{
+		std::vector< bool > outliers(samples.size(), false);
+
+		const auto median    = Median(samples);
+		const auto deviation = g_mad_scale * MedianAbsoluteDeviation(samples);
+		if (0.0 == deviation)
+		{
+			return outliers;
+		}
+
+		const auto bound = threshold * deviation;
+		for (std::size_t i = 0u; i < samples.size(); ++i)
+		{
+			outliers[i] = bound < std::abs(samples[i] - median);
+		}
+
+		return outliers;
+	}
+
+	[[nodiscard]]
+	MannWhitneyUResult MannWhitneyUTest(const std::vector< F64 >& lhs,
+										const std::vector< F64 >& rhs)
+	{
+		MannWhitneyUResult result;
+		if (lhs.empty() || rhs.empty())
+		{
+			return result;
+		}
+
+		// Pools the samples, marking the samples of lhs.
+		std::vector< std::pair< F64, bool > > samples;
+		samples.reserve(lhs.size() + rhs.size());
+		for (const auto sample : lhs)
+		{
+			samples.emplace_back(sample, true);
+		}
+		for (const auto sample : rhs)
+		{
+			samples.emplace_back(sample, false);
+		}
+		std::sort(samples.begin(), samples.end());
+
+		// Sums the ranks of lhs, assigning the average rank to ties.
+		F64 rank_sum = 0.0;
+		F64 tie_sum  = 0.0;
+		for (std::size_t i = 0u; i < samples.size();)
+		{
+			auto j = i + 1u;
+			while (j < samples.size() && samples[j].first == samples[i].first)
+			{
+				++j;
+			}
+
+			const auto count = static_cast< F64 >(j - i);
+			// The average of the 1-based ranks i + 1 to j.
+			const auto rank  = 0.5 * static_cast< F64 >(i + 1u + j);
+			for (; i < j; ++i)
+			{
+				if (samples[i].second)
+				{
+					rank_sum += rank;
+				}
+			}
+			tie_sum += count * count * count - count;
+		}
+
+		const auto n1 = static_cast< F64 >(lhs.size());
+		const auto n2 = static_cast< F64 >(rhs.size());
+		const auto n  = n1 + n2;
+
+		result.m_u           = rank_sum - 0.5 * n1 * (n1 + 1.0);
+		result.m_effect_size = result.m_u / (n1 * n2);
+
+		// Uses the normal approximation with tie correction.
+		const auto variance = (n1 * n2 / 12.0)
+							* ((n + 1.0) - tie_sum / (n * (n - 1.0)));
+		if (0.0 >= variance)
+		{
+			return result;
+		}
+
+		// Applies the continuity correction towards the mean.
+		const auto mean = 0.5 * n1 * n2;
+		const auto difference = result.m_u - mean;
+		const auto correction = (0.0 < difference) ? 0.5
+							  : (0.0 > difference) ? -0.5 : 0.0;
+		result.m_z       = (difference - correction) / std::sqrt(variance);
+		result.m_p_value = 0.5 * std::erfc(result.m_z / std::sqrt(2.0));
+
+		return result;
+	}
+}
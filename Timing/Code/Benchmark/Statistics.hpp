@@ -0,0 +1,110 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// F64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	/**
+	 A struct of Mann-Whitney U test results.
+	 */
+	struct MannWhitneyUResult
+	{
+		/**
+		 The U statistic (i.e. the number of sample pairs in which the first
+		 sample is greater, counting ties as one half) of this Mann-Whitney
+		 U test result.
+		 */
+		F64 m_u = 0.0;
+
+		/**
+		 The standard score (i.e. of the normal approximation with tie and
+		 continuity correction) of this Mann-Whitney U test result.
+		 */
+		F64 m_z = 0.0;
+
+		/**
+		 The one-sided p-value (i.e. the probability of a U statistic at
+		 least this large if both samples come from the same distribution)
+		 of this Mann-Whitney U test result.
+		 */
+		F64 m_p_value = 1.0;
+
+		/**
+		 The effect size (i.e. the probability of superiority: the
+		 probability that a random first sample is greater than a random
+		 second sample, with 0.5 indicating no effect) of this Mann-Whitney
+		 U test result.
+		 */
+		F64 m_effect_size = 0.5;
+	};
+
+	/**
+	 Returns the median of the given samples.
+
+	 @param[in]		samples
+					The samples.
+	 @return		The median of the given samples, or zero if there are no
+					samples.
+	 */
+	[[nodiscard]]
+	F64 Median(std::vector< F64 > samples);
+
+	/**
+	 Returns the median absolute deviation (MAD) of the given samples.
+
+	 @param[in]		samples
+					A reference to the samples.
+	 @return		The median absolute deviation of the given samples, or
+					zero if there are no samples.
+	 */
+	[[nodiscard]]
+	F64 MedianAbsoluteDeviation(const std::vector< F64 >& samples);
+
+	/**
+	 Detects the outliers of the given samples. A sample is an outlier if it
+	 deviates more than the given threshold times the scaled median absolute
+	 deviation (i.e. a robust estimate of the standard deviation) from the
+	 median.
+
+	 @param[in]		samples
+					A reference to the samples.
+	 @param[in]		threshold
+					The threshold (e.g., 3).
+	 @return		A flag per sample indicating whether it is an outlier.
+	 */
+	[[nodiscard]]
+	std::vector< bool > DetectOutliers(const std::vector< F64 >& samples,
+									   F64 threshold);
+
+	/**
+	 Tests whether the first samples tend to be greater than the second
+	 samples (i.e. a one-sided Mann-Whitney U test). In contrast to comparing
+	 means, the test is rank-based and therefore robust against outliers and
+	 non-normal distributions.
+
+	 @param[in]		lhs
+					A reference to the first samples.
+	 @param[in]		rhs
+					A reference to the second samples.
+	 @return		The Mann-Whitney U test result, or a result without
+					effect if one of the samples is empty.
+	 */
+	[[nodiscard]]
+	MannWhitneyUResult MannWhitneyUTest(const std::vector< F64 >& lhs,
+										const std::vector< F64 >& rhs);
+}
@@ -0,0 +1,68 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <IO/Json.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// ostream
+#include <ostream>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	void WriteJsonString(std::ostream& stream, std::string_view str)
+	{
+		static constexpr char s_hex_digits[] = "0123456789abcdef";
+
+		stream.put('"');
+		for (const auto c : str)
+		{
+			switch (c)
+			{
+
+			case '"':
+				stream << "\\\"";
+				break;
+			case '\\':
+				stream << "\\\\";
+				break;
+			case '\b':
+				stream << "\\b";
+				break;
+			case '\f':
+				stream << "\\f";
+				break;
+			case '\n':
+				stream << "\\n";
+				break;
+			case '\r':
+				stream << "\\r";
+				break;
+			case '\t':
+				stream << "\\t";
+				break;
+			default:
+				if (static_cast< unsigned char >(c) < 0x20u)
+				{
+					const auto code = static_cast< unsigned char >(c);
+					stream << "\\u00"
+						   << s_hex_digits[code >> 4u]
+						   << s_hex_digits[code & 0xFu];
+				}
+				else
+				{
+					stream.put(c);
+				}
+				break;
+			}
+		}
+		stream.put('"');
+	}
+}
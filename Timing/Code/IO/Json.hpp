@@ -0,0 +1,27 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// ostream
+#include <iosfwd>
+// string_view
+#include <string_view>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	/**
+	 Writes the given string as a quoted and escaped JSON string to the given
+	 output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		str
+					The string.
+	 */
+	void WriteJsonString(std::ostream& stream, std::string_view str);
+}
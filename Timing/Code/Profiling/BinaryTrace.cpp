@@ -0,0 +1,832 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/BinaryTrace.hpp>
+// WriteJsonString
+#include <IO/Json.hpp>
+
+#ifdef _WIN32
+
+// CreateFileMappingW, CreateFileW, MapViewOfFile, SetEndOfFile,
+// SetFilePointerEx, UnmapViewOfFile
+#include <System/Windows.hpp>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max, min, sort
+#include <algorithm>
+// memcpy, strlen
+#include <cstring>
+// fixed, setprecision, setw
+#include <iomanip>
+// numeric_limits
+#include <limits>
+// ostream
+#include <ostream>
+// pair
+#include <utility>
+
+#ifndef _WIN32
+
+// open, O_CREAT, O_RDWR, O_TRUNC
+#include <fcntl.h>
+// mmap, munmap, MAP_FAILED, MAP_SHARED, PROT_WRITE
+#include <sys/mman.h>
+// close, ftruncate
+#include <unistd.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The magic bytes of binary traces.
+		 */
+		constexpr char g_magic[8] = { 'M', 'A', 'G', 'E', 'T', 'R', 'C', '\0' };
+
+		/**
+		 The version of binary traces.
+		 */
+		constexpr U64 g_version = 1u;
+
+		/**
+		 The name of the trace clock.
+		 */
+		constexpr std::string_view g_clock_name = "TscClock";
+
+		/**
+		 The maximum length of an interned string.
+		 */
+		constexpr std::size_t g_max_string_length = 4096u;
+
+		/**
+		 The maximum size (in bytes) of a varint.
+		 */
+		constexpr std::size_t g_max_varint_size = 10u;
+
+		/**
+		 An enumeration of the different binary trace record tags.
+		 */
+		enum class RecordTag : U8
+		{
+			Padding = 0u,
+			String  = 1u,
+			Begin   = 2u,
+			End     = 3u,
+			Instant = 4u
+		};
+
+		/**
+		 Encodes the given value as a varint.
+
+		 @param[in]		output
+						A pointer to the output bytes (with room for at least
+						@c g_max_varint_size bytes).
+		 @param[in]		value
+						The value.
+		 @return		A pointer past the last written byte.
+		 */
+		U8* EncodeVarint(U8* output, U64 value) noexcept
+		{
+			while (0x80u <= value)
+			{
+				*output++ = static_cast< U8 >(value | 0x80u);
+				value >>= 7u;
+			}
+
+			*output++ = static_cast< U8 >(value);
+			return output;
+		}
+
+		/**
+		 Zigzag-encodes the given signed difference (i.e. maps small
+		 negative and positive values to small unsigned values).
+
+		 @param[in]		value
+						The signed difference (in two's complement).
+		 @return		The zigzag-encoded value.
+		 */
+		[[nodiscard]]
+		constexpr U64 EncodeZigzag(U64 value) noexcept
+		{
+			return (value << 1u) ^ (0u - (value >> 63u));
+		}
+
+		/**
+		 Zigzag-decodes the given value.
+
+		 @param[in]		value
+						The zigzag-encoded value.
+		 @return		The signed difference (in two's complement).
+		 */
+		[[nodiscard]]
+		constexpr U64 DecodeZigzag(U64 value) noexcept
+		{
+			return (value >> 1u) ^ (0u - (value & 1u));
+		}
+
+		/**
+		 Returns the Chrome Trace Event phase of the given trace event type.
+
+		 @param[in]		type
+						The trace event type.
+		 @return		The Chrome Trace Event phase of the given trace event
+						type.
+		 */
+		[[nodiscard]]
+		constexpr char ToChromePhase(TraceEventType type) noexcept
+		{
+			switch (type)
+			{
+
+			case TraceEventType::Begin:
+				return 'B';
+			case TraceEventType::End:
+				return 'E';
+			default:
+				return 'i';
+			}
+		}
+
+		/**
+		 Returns the size of the header of binary traces.
+
+		 @return		The size (in bytes) of the header of binary traces.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t GetHeaderSize() noexcept
+		{
+			return sizeof(g_magic) + 5u * g_max_varint_size
+				 + g_clock_name.size();
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// BinaryTraceWriter
+	//-------------------------------------------------------------------------
+
+	BinaryTraceWriter::BinaryTraceWriter(const std::filesystem::path& fname,
+										 std::size_t chunk_size)
+		: m_file(-1),
+		m_chunk_size(std::max(
+			(chunk_size + 0xFFFFu) & ~std::size_t(0xFFFFu),
+			std::size_t(0x10000u))),
+		m_chunk(nullptr),
+		m_chunk_offset(0u),
+		m_chunk_used(0u),
+		m_origin(static_cast< U64 >(
+			TraceBuffer::ClockType::now().time_since_epoch().count())),
+		m_previous_timestamps(),
+		m_ids_by_pointer(),
+		m_ids_by_name(),
+		m_flush_mutex(),
+		m_flusher(),
+		m_stop_mutex(),
+		m_stop_condition(),
+		m_stop(false)
+	{
+#ifdef _WIN32
+		const auto file = ::CreateFileW(fname.c_str(),
+										GENERIC_READ | GENERIC_WRITE,
+										FILE_SHARE_READ,
+										nullptr,
+										CREATE_ALWAYS,
+										FILE_ATTRIBUTE_NORMAL,
+										nullptr);
+		if (INVALID_HANDLE_VALUE == file)
+		{
+			return;
+		}
+
+		m_file = reinterpret_cast< std::intptr_t >(file);
+#else
+		const auto file = ::open(fname.c_str(), O_CREAT | O_RDWR | O_TRUNC,
+								 0644);
+		if (0 > file)
+		{
+			return;
+		}
+
+		m_file = file;
+#endif
+
+		if (!MapChunk(0u))
+		{
+			Close();
+			return;
+		}
+
+		// The period of the trace clock is only known at runtime.
+		const auto ticks_per_second = static_cast< U64 >(
+			TraceBuffer::ClockType::TicksPerSecond() + 0.5);
+
+		auto output = Reserve(GetHeaderSize());
+		std::memcpy(output, g_magic, sizeof(g_magic));
+		output = EncodeVarint(output + sizeof(g_magic), g_version);
+		output = EncodeVarint(output, 1u);
+		output = EncodeVarint(output, ticks_per_second);
+		output = EncodeVarint(output, m_origin);
+		output = EncodeVarint(output, g_clock_name.size());
+		std::memcpy(output, g_clock_name.data(), g_clock_name.size());
+		output += g_clock_name.size();
+
+		m_chunk_used = static_cast< std::size_t >(output - m_chunk);
+	}
+
+	BinaryTraceWriter::~BinaryTraceWriter()
+	{
+		StopBackgroundFlush();
+		Flush();
+		Close();
+	}
+
+	std::size_t BinaryTraceWriter::Flush()
+	{
+		const std::scoped_lock flush_lock(m_flush_mutex);
+
+		return DrainTraceBuffers([this](U32 tid, const TraceEvent& event)
+		{
+			Write(tid, event);
+		});
+	}
+
+	void BinaryTraceWriter::StartBackgroundFlush(
+		std::chrono::milliseconds period)
+	{
+		StopBackgroundFlush();
+
+		m_stop = false;
+		m_flusher = std::thread([this, period]()
+		{
+			std::unique_lock lock(m_stop_mutex);
+			while (!m_stop_condition.wait_for(lock, period,
+											  [this]() { return m_stop; }))
+			{
+				lock.unlock();
+				Flush();
+				lock.lock();
+			}
+		});
+	}
+
+	void BinaryTraceWriter::StopBackgroundFlush()
+	{
+		if (!m_flusher.joinable())
+		{
+			return;
+		}
+
+		{
+			const std::scoped_lock lock(m_stop_mutex);
+			m_stop = true;
+		}
+		m_stop_condition.notify_all();
+		m_flusher.join();
+	}
+
+	void BinaryTraceWriter::Write(U32 thread_index, const TraceEvent& event)
+	{
+		if (!IsOpen())
+		{
+			return;
+		}
+
+		const auto id = Intern(event.m_name);
+
+		if (m_previous_timestamps.size() <= thread_index)
+		{
+			m_previous_timestamps.resize(thread_index + 1u, m_origin);
+		}
+
+		auto& previous = m_previous_timestamps[thread_index];
+		const auto delta = EncodeZigzag(event.m_timestamp - previous);
+		previous = event.m_timestamp;
+
+		RecordTag tag;
+		switch (event.m_type)
+		{
+
+		case TraceEventType::Begin:
+			tag = RecordTag::Begin;
+			break;
+		case TraceEventType::End:
+			tag = RecordTag::End;
+			break;
+		default:
+			tag = RecordTag::Instant;
+			break;
+		}
+
+		auto output = Reserve(1u + 3u * g_max_varint_size);
+		if (nullptr == output)
+		{
+			return;
+		}
+
+		*output++ = static_cast< U8 >(tag);
+		output = EncodeVarint(output, thread_index);
+		output = EncodeVarint(output, id);
+		output = EncodeVarint(output, delta);
+
+		m_chunk_used = static_cast< std::size_t >(output - m_chunk);
+	}
+
+	U64 BinaryTraceWriter::Intern(const char* name)
+	{
+		if (nullptr == name)
+		{
+			name = "";
+		}
+
+		if (const auto it = m_ids_by_pointer.find(name);
+			m_ids_by_pointer.end() != it)
+		{
+			return it->second;
+		}
+
+		// Equal names at different addresses share a single string id.
+		const std::string_view str(name, std::min(std::strlen(name),
+												  g_max_string_length));
+		const auto [it, inserted] = m_ids_by_name.try_emplace(
+			std::string(str), m_ids_by_name.size());
+		const auto id = it->second;
+		m_ids_by_pointer.emplace(name, id);
+
+		if (inserted)
+		{
+			auto output = Reserve(1u + 2u * g_max_varint_size + str.size());
+			if (nullptr != output)
+			{
+				*output++ = static_cast< U8 >(RecordTag::String);
+				output = EncodeVarint(output, id);
+				output = EncodeVarint(output, str.size());
+				std::memcpy(output, str.data(), str.size());
+				output += str.size();
+
+				m_chunk_used = static_cast< std::size_t >(output - m_chunk);
+			}
+		}
+
+		return id;
+	}
+
+	[[nodiscard]]
+	U8* BinaryTraceWriter::Reserve(std::size_t size)
+	{
+		if (!IsOpen())
+		{
+			return nullptr;
+		}
+
+		if (m_chunk_size - m_chunk_used < size)
+		{
+			// The remainder of the chunk is zero-filled (i.e. padding).
+			const auto offset = m_chunk_offset + m_chunk_size;
+			UnmapChunk();
+			if (!MapChunk(offset))
+			{
+				Close();
+				return nullptr;
+			}
+		}
+
+		return m_chunk + m_chunk_used;
+	}
+
+	bool BinaryTraceWriter::MapChunk(U64 offset)
+	{
+		const auto size = offset + m_chunk_size;
+
+#ifdef _WIN32
+		const auto file    = reinterpret_cast< HANDLE >(m_file);
+		// Creating the file mapping grows the file to the given size.
+		const auto mapping = ::CreateFileMappingW(
+			file, nullptr, PAGE_READWRITE,
+			static_cast< DWORD >(size >> 32u),
+			static_cast< DWORD >(size & 0xFFFFFFFFu),
+			nullptr);
+		if (nullptr == mapping)
+		{
+			return false;
+		}
+
+		const auto chunk = ::MapViewOfFile(
+			mapping, FILE_MAP_WRITE,
+			static_cast< DWORD >(offset >> 32u),
+			static_cast< DWORD >(offset & 0xFFFFFFFFu),
+			m_chunk_size);
+		// The view keeps the file mapping alive.
+		::CloseHandle(mapping);
+		if (nullptr == chunk)
+		{
+			return false;
+		}
+#else
+		const auto file = static_cast< int >(m_file);
+		if (0 != ::ftruncate(file, static_cast< off_t >(size)))
+		{
+			return false;
+		}
+
+		const auto chunk = ::mmap(nullptr, m_chunk_size, PROT_WRITE,
+								  MAP_SHARED, file,
+								  static_cast< off_t >(offset));
+		if (MAP_FAILED == chunk)
+		{
+			return false;
+		}
+#endif
+
+		m_chunk        = static_cast< U8* >(chunk);
+		m_chunk_offset = offset;
+		m_chunk_used   = 0u;
+		return true;
+	}
+
+	void BinaryTraceWriter::UnmapChunk() noexcept
+	{
+		if (nullptr == m_chunk)
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		::UnmapViewOfFile(m_chunk);
+#else
+		::munmap(m_chunk, m_chunk_size);
+#endif
+
+		m_chunk = nullptr;
+	}
+
+	void BinaryTraceWriter::Close() noexcept
+	{
+		if (-1 == m_file)
+		{
+			return;
+		}
+
+		// If mapping the next chunk failed, the previous chunk is the last.
+		const auto size = m_chunk_offset + m_chunk_used;
+		UnmapChunk();
+
+#ifdef _WIN32
+		const auto file = reinterpret_cast< HANDLE >(m_file);
+		LARGE_INTEGER position = {};
+		position.QuadPart = static_cast< LONGLONG >(size);
+		if (FALSE != ::SetFilePointerEx(file, position, nullptr, FILE_BEGIN))
+		{
+			::SetEndOfFile(file);
+		}
+		::CloseHandle(file);
+#else
+		const auto file = static_cast< int >(m_file);
+		static_cast< void >(::ftruncate(file, static_cast< off_t >(size)));
+		::close(file);
+#endif
+
+		m_file = -1;
+	}
+
+	//-------------------------------------------------------------------------
+	// BinaryTraceReader
+	//-------------------------------------------------------------------------
+
+	BinaryTraceReader::BinaryTraceReader(const std::filesystem::path& fname,
+										 std::size_t buffer_size)
+		: m_stream(fname, std::ios::binary),
+		m_buffer(std::max(buffer_size, std::size_t(1u))),
+		m_position(0u),
+		m_size(0u),
+		m_header(),
+		m_strings(),
+		m_previous_timestamps(),
+		m_open(false),
+		m_error(false)
+	{
+		m_open = m_stream.is_open() && ReadHeader();
+	}
+
+	bool BinaryTraceReader::Next(BinaryTraceEvent& event)
+	{
+		if (!m_open || m_error)
+		{
+			return false;
+		}
+
+		U8 tag;
+		while (ReadByte(tag))
+		{
+			switch (static_cast< RecordTag >(tag))
+			{
+
+			case RecordTag::Padding:
+				break;
+
+			case RecordTag::String:
+			{
+				U64 id;
+				U64 length;
+				std::string str;
+				if (!ReadVarint(id) || !ReadVarint(length)
+					|| g_max_string_length < length
+					|| !ReadString(length, str)
+					|| m_strings.size() != id)
+				{
+					m_error = true;
+					return false;
+				}
+
+				m_strings.push_back(std::move(str));
+				break;
+			}
+
+			case RecordTag::Begin:
+			case RecordTag::End:
+			case RecordTag::Instant:
+			{
+				U64 thread_index;
+				U64 id;
+				U64 delta;
+				if (!ReadVarint(thread_index) || !ReadVarint(id)
+					|| !ReadVarint(delta)
+					|| std::numeric_limits< U32 >::max() < thread_index
+					|| m_strings.size() <= id)
+				{
+					m_error = true;
+					return false;
+				}
+
+				if (m_previous_timestamps.size() <= thread_index)
+				{
+					m_previous_timestamps.resize(
+						static_cast< std::size_t >(thread_index) + 1u,
+						m_header.m_origin);
+				}
+
+				auto& previous = m_previous_timestamps[
+					static_cast< std::size_t >(thread_index)];
+				previous += DecodeZigzag(delta);
+				const auto string_index = static_cast< std::size_t >(id);
+
+				event.m_timestamp    = previous;
+				event.m_name         = m_strings[string_index];
+				event.m_thread_index = static_cast< U32 >(thread_index);
+				event.m_type         = static_cast< TraceEventType >(
+					tag - static_cast< U8 >(RecordTag::Begin));
+				return true;
+			}
+
+			default:
+				m_error = true;
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	bool BinaryTraceReader::ReadHeader()
+	{
+		char magic[sizeof(g_magic)];
+		for (auto& c : magic)
+		{
+			U8 value;
+			if (!ReadByte(value))
+			{
+				return false;
+			}
+
+			c = static_cast< char >(value);
+		}
+
+		if (0 != std::memcmp(magic, g_magic, sizeof(g_magic)))
+		{
+			return false;
+		}
+
+		U64 version;
+		U64 length;
+		return ReadVarint(version) && g_version == version
+			&& ReadVarint(m_header.m_period_numerator)
+			&& ReadVarint(m_header.m_period_denominator)
+			&& ReadVarint(m_header.m_origin)
+			&& ReadVarint(length) && g_max_string_length >= length
+			&& ReadString(length, m_header.m_clock);
+	}
+
+	bool BinaryTraceReader::ReadByte(U8& value)
+	{
+		if (m_size == m_position)
+		{
+			m_stream.read(reinterpret_cast< char* >(m_buffer.data()),
+						  static_cast< std::streamsize >(m_buffer.size()));
+			m_size     = static_cast< std::size_t >(m_stream.gcount());
+			m_position = 0u;
+			if (0u == m_size)
+			{
+				return false;
+			}
+		}
+
+		value = m_buffer[m_position++];
+		return true;
+	}
+
+	bool BinaryTraceReader::ReadVarint(U64& value)
+	{
+		value = 0u;
+		for (U32 shift = 0u; 64u > shift; shift += 7u)
+		{
+			U8 byte;
+			if (!ReadByte(byte))
+			{
+				return false;
+			}
+
+			value |= static_cast< U64 >(byte & 0x7Fu) << shift;
+			if (0u == (byte & 0x80u))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool BinaryTraceReader::ReadString(U64 length, std::string& str)
+	{
+		str.resize(static_cast< std::size_t >(length));
+		for (auto& c : str)
+		{
+			U8 value;
+			if (!ReadByte(value))
+			{
+				return false;
+			}
+
+			c = static_cast< char >(value);
+		}
+
+		return true;
+	}
+
+	//-------------------------------------------------------------------------
+	// Binary Trace Conversion
+	//-------------------------------------------------------------------------
+
+	bool WriteBinaryTraceSummary(std::ostream& stream,
+								 BinaryTraceReader& reader)
+	{
+		struct Statistics
+		{
+			std::string_view m_name;
+			U64 m_count = 0u;
+			U64 m_total = 0u;
+			U64 m_min   = std::numeric_limits< U64 >::max();
+			U64 m_max   = 0u;
+		};
+
+		std::unordered_map< const char*, Statistics > statistics;
+		// The open zones (i.e. name and begin timestamp) per thread index.
+		std::vector< std::vector< std::pair< std::string_view, U64 > > >
+			stacks;
+		U64 event_count = 0u;
+
+		BinaryTraceEvent event;
+		while (reader.Next(event))
+		{
+			++event_count;
+
+			if (stacks.size() <= event.m_thread_index)
+			{
+				stacks.resize(event.m_thread_index + 1u);
+			}
+
+			auto& stack = stacks[event.m_thread_index];
+			if (TraceEventType::Begin == event.m_type)
+			{
+				stack.emplace_back(event.m_name, event.m_timestamp);
+			}
+			else if (TraceEventType::End == event.m_type && !stack.empty())
+			{
+				const auto [name, begin] = stack.back();
+				stack.pop_back();
+
+				// Names are interned: equal names share their data.
+				auto& entry = statistics[name.data()];
+				const auto duration = event.m_timestamp - begin;
+				entry.m_name   = name;
+				entry.m_count += 1u;
+				entry.m_total += duration;
+				entry.m_min    = std::min(entry.m_min, duration);
+				entry.m_max    = std::max(entry.m_max, duration);
+			}
+		}
+
+		std::vector< Statistics > sorted;
+		sorted.reserve(statistics.size());
+		std::size_t name_width = 4u;
+		for (const auto& [key, entry] : statistics)
+		{
+			sorted.push_back(entry);
+			name_width = std::max(name_width, entry.m_name.size());
+		}
+
+		std::sort(sorted.begin(), sorted.end(),
+				  [](const Statistics& lhs, const Statistics& rhs)
+		{
+			return lhs.m_total > rhs.m_total;
+		});
+
+		const auto& header = reader.GetHeader();
+		const auto ticks_per_second = header.GetTicksPerSecond();
+		const auto us_per_tick = (0.0 < ticks_per_second)
+							   ? 1.0e6 / ticks_per_second : 0.0;
+
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << "Clock: " << header.m_clock << " ("
+			   << ticks_per_second << " ticks/s), events: " << event_count
+			   << ", threads: " << stacks.size() << '\n';
+		stream << std::left  << std::setw(static_cast< int >(name_width))
+			   << "Zone"
+			   << std::right << std::setw(12) << "Count"
+			   << std::setw(16) << "Total (us)"
+			   << std::setw(14) << "Mean (us)"
+			   << std::setw(14) << "Min (us)"
+			   << std::setw(14) << "Max (us)" << '\n';
+
+		stream << std::fixed << std::setprecision(3);
+		for (const auto& entry : sorted)
+		{
+			const auto total = static_cast< F64 >(entry.m_total) * us_per_tick;
+			stream << std::left  << std::setw(static_cast< int >(name_width))
+				   << entry.m_name
+				   << std::right << std::setw(12) << entry.m_count
+				   << std::setw(16) << total
+				   << std::setw(14) << total / static_cast< F64 >(entry.m_count)
+				   << std::setw(14)
+				   << static_cast< F64 >(entry.m_min) * us_per_tick
+				   << std::setw(14)
+				   << static_cast< F64 >(entry.m_max) * us_per_tick << '\n';
+		}
+
+		stream.flags(flags);
+		stream.precision(precision);
+
+		return !reader.HasError();
+	}
+
+	bool WriteBinaryTraceAsChromeJson(std::ostream& stream,
+									  BinaryTraceReader& reader)
+	{
+		const auto& header = reader.GetHeader();
+		const auto ticks_per_us = header.GetTicksPerSecond() * 1.0e-6;
+		const auto origin = static_cast< F64 >(header.m_origin);
+
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << std::fixed << std::setprecision(3);
+		stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+		U64 count = 0u;
+		BinaryTraceEvent event;
+		while (reader.Next(event))
+		{
+			const auto ts = (0.0 < ticks_per_us)
+				? (static_cast< F64 >(event.m_timestamp) - origin)
+				/ ticks_per_us : 0.0;
+
+			stream << ((0u == count++) ? "\n" : ",\n") << "{\"name\":";
+			WriteJsonString(stream, event.m_name);
+			stream << ",\"ph\":\"" << ToChromePhase(event.m_type) << '"';
+			if (TraceEventType::Instant == event.m_type)
+			{
+				stream << ",\"s\":\"t\"";
+			}
+			stream << ",\"ts\":"   << ts
+				   << ",\"pid\":0,\"tid\":" << event.m_thread_index << '}';
+		}
+
+		stream << "\n]}\n";
+
+		stream.flags(flags);
+		stream.precision(precision);
+
+		return !reader.HasError();
+	}
+}
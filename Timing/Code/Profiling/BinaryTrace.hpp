@@ -0,0 +1,680 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TraceBuffer, TraceEvent, TraceEventType
+#include <Profiling/TraceRecorder.hpp>
+// F64, U8, U32, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// milliseconds
+#include <chrono>
+// condition_variable
+#include <condition_variable>
+// size_t
+#include <cstddef>
+// intptr_t
+#include <cstdint>
+// deque
+#include <deque>
+// path
+#include <filesystem>
+// ifstream
+#include <fstream>
+// ostream
+#include <iosfwd>
+// mutex
+#include <mutex>
+// string
+#include <string>
+// string_view
+#include <string_view>
+// thread
+#include <thread>
+// unordered_map
+#include <unordered_map>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Binary Trace Format
+	//-------------------------------------------------------------------------
+
+	/*
+	 A binary trace consists of a header followed by a sequence of records.
+	 All integers are unsigned LEB128 varints.
+
+	 Header:
+	   "MAGETRC\0"          magic
+	   version
+	   period numerator     (seconds per tick of the trace clock)
+	   period denominator
+	   origin               (timestamp in ticks of the trace clock)
+	   clock name length, clock name bytes
+
+	 Records (starting with a one-byte tag):
+	   0 Padding            (up to the end of a chunk)
+	   1 String             id, length, bytes
+	   2 Begin, 3 End,      thread index, string id of the name,
+	   4 Instant            zigzag timestamp delta (in ticks, relative to the
+	                        previous event of the same thread or the origin)
+
+	 Strings are defined before their first use, so traces can be decoded
+	 in a single streaming pass.
+	 */
+
+	/**
+	 A struct of binary trace headers.
+	 */
+	struct BinaryTraceHeader
+	{
+		/**
+		 Returns the number of ticks per second of the trace clock of this
+		 binary trace header.
+
+		 @return		The number of ticks per second of the trace clock of
+						this binary trace header.
+		 */
+		[[nodiscard]]
+		F64 GetTicksPerSecond() const noexcept
+		{
+			return (0u == m_period_numerator) ? 0.0
+				: static_cast< F64 >(m_period_denominator)
+				/ static_cast< F64 >(m_period_numerator);
+		}
+
+		/**
+		 The name of the trace clock of this binary trace header.
+		 */
+		std::string m_clock;
+
+		/**
+		 The numerator of the period (in seconds) of the trace clock of this
+		 binary trace header.
+		 */
+		U64 m_period_numerator = 0u;
+
+		/**
+		 The denominator of the period (in seconds) of the trace clock of this
+		 binary trace header.
+		 */
+		U64 m_period_denominator = 0u;
+
+		/**
+		 The origin timestamp (in ticks of the trace clock) of this binary
+		 trace header.
+		 */
+		U64 m_origin = 0u;
+	};
+
+	/**
+	 A struct of binary trace events (i.e. decoded trace events).
+	 */
+	struct BinaryTraceEvent
+	{
+		/**
+		 The timestamp (in ticks of the trace clock) of this binary trace
+		 event.
+		 */
+		U64 m_timestamp = 0u;
+
+		/**
+		 The name of this binary trace event. The name remains valid as long
+		 as the binary trace reader which decoded this binary trace event.
+		 */
+		std::string_view m_name;
+
+		/**
+		 The index of the thread of this binary trace event.
+		 */
+		U32 m_thread_index = 0u;
+
+		/**
+		 The type of this binary trace event.
+		 */
+		TraceEventType m_type = TraceEventType::Instant;
+	};
+
+	//-------------------------------------------------------------------------
+	// BinaryTraceWriter
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of binary trace writers draining the trace buffers of all
+	 threads into a binary trace file.
+
+	 The file is grown and memory-mapped in fixed-size chunks: encoding a
+	 trace event only writes to memory, and system calls are only performed
+	 once per chunk.
+	 */
+	class BinaryTraceWriter
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The default chunk size (in bytes) of binary trace writers.
+		 */
+		static constexpr std::size_t s_default_chunk_size
+			= std::size_t(4u) << 20u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a binary trace writer.
+
+		 @param[in]		fname
+						A reference to the path of the binary trace file.
+		 @param[in]		chunk_size
+						The chunk size (in bytes). The chunk size is rounded
+						up to a multiple of 64 KiB.
+		 @note			If the file cannot be created, the trace events are
+						drained but discarded (see @c IsOpen).
+		 */
+		explicit BinaryTraceWriter(const std::filesystem::path& fname,
+								   std::size_t chunk_size
+								   = s_default_chunk_size);
+
+		/**
+		 Constructs a binary trace writer from the given binary trace writer.
+
+		 @param[in]		writer
+						A reference to the binary trace writer to copy.
+		 */
+		BinaryTraceWriter(const BinaryTraceWriter& writer) = delete;
+
+		/**
+		 Constructs a binary trace writer by moving the given binary trace
+		 writer.
+
+		 @param[in]		writer
+						A reference to the binary trace writer to move.
+		 */
+		BinaryTraceWriter(BinaryTraceWriter&& writer) = delete;
+
+		/**
+		 Destructs this binary trace writer. The background flusher is
+		 stopped, the remaining trace events are flushed and the file is
+		 truncated to its used size.
+		 */
+		~BinaryTraceWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given binary trace writer to this binary trace writer.
+
+		 @param[in]		writer
+						A reference to the binary trace writer to copy.
+		 @return		A reference to the copy of the given binary trace
+						writer (i.e. this binary trace writer).
+		 */
+		BinaryTraceWriter& operator=(const BinaryTraceWriter& writer) = delete;
+
+		/**
+		 Moves the given binary trace writer to this binary trace writer.
+
+		 @param[in]		writer
+						A reference to the binary trace writer to move.
+		 @return		A reference to the moved binary trace writer (i.e. this
+						binary trace writer).
+		 */
+		BinaryTraceWriter& operator=(BinaryTraceWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the file of this binary trace writer is open.
+
+		 @return		@c true if the file of this binary trace writer is
+						open. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOpen() const noexcept
+		{
+			return nullptr != m_chunk;
+		}
+
+		/**
+		 Drains the trace buffers of all threads and writes their trace
+		 events.
+
+		 @return		The number of written trace events.
+		 */
+		std::size_t Flush();
+
+		/**
+		 Starts flushing periodically on a background thread.
+
+		 @param[in]		period
+						The flush period.
+		 */
+		void StartBackgroundFlush(std::chrono::milliseconds period);
+
+		/**
+		 Stops flushing periodically on a background thread.
+		 */
+		void StopBackgroundFlush();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Writes the given trace event.
+
+		 @param[in]		thread_index
+						The index of the thread of the trace event.
+		 @param[in]		event
+						A reference to the trace event.
+		 */
+		void Write(U32 thread_index, const TraceEvent& event);
+
+		/**
+		 Returns the string id of the given name, writing a string record
+		 first if the name is not interned yet.
+
+		 @param[in]		name
+						A pointer to the null-terminated name.
+		 @return		The string id of the given name.
+		 */
+		U64 Intern(const char* name);
+
+		/**
+		 Reserves the given number of bytes in the current chunk of this
+		 binary trace writer, mapping the next chunk if needed.
+
+		 @param[in]		size
+						The number of bytes (at most the chunk size).
+		 @return		A pointer to the reserved bytes, or @c nullptr if the
+						file is not open.
+		 */
+		[[nodiscard]]
+		U8* Reserve(std::size_t size);
+
+		/**
+		 Maps the chunk at the given offset of the file of this binary trace
+		 writer.
+
+		 @param[in]		offset
+						The offset (in bytes) of the chunk.
+		 @return		@c true if the chunk is mapped. @c false otherwise.
+		 */
+		bool MapChunk(U64 offset);
+
+		/**
+		 Unmaps the current chunk of this binary trace writer.
+		 */
+		void UnmapChunk() noexcept;
+
+		/**
+		 Closes the file of this binary trace writer, truncating it to its
+		 used size.
+		 */
+		void Close() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The native file handle (or descriptor) of this binary trace writer.
+		 */
+		std::intptr_t m_file;
+
+		/**
+		 The chunk size (in bytes) of this binary trace writer.
+		 */
+		std::size_t m_chunk_size;
+
+		/**
+		 A pointer to the current chunk of this binary trace writer.
+		 */
+		U8* m_chunk;
+
+		/**
+		 The file offset (in bytes) of the current chunk of this binary trace
+		 writer.
+		 */
+		U64 m_chunk_offset;
+
+		/**
+		 The number of used bytes of the current chunk of this binary trace
+		 writer.
+		 */
+		std::size_t m_chunk_used;
+
+		/**
+		 The origin timestamp (in ticks of the trace clock) of this binary
+		 trace writer.
+		 */
+		U64 m_origin;
+
+		/**
+		 The previous timestamp per thread index of this binary trace
+		 writer.
+		 */
+		std::vector< U64 > m_previous_timestamps;
+
+		/**
+		 The string ids per name pointer of this binary trace writer.
+		 */
+		std::unordered_map< const char*, U64 > m_ids_by_pointer;
+
+		/**
+		 The string ids per name of this binary trace writer.
+		 */
+		std::unordered_map< std::string, U64 > m_ids_by_name;
+
+		/**
+		 The mutex serializing the flushes of this binary trace writer.
+		 */
+		std::mutex m_flush_mutex;
+
+		/**
+		 The background flusher of this binary trace writer.
+		 */
+		std::thread m_flusher;
+
+		/**
+		 The mutex guarding the stop flag of this binary trace writer.
+		 */
+		std::mutex m_stop_mutex;
+
+		/**
+		 The condition variable signaling the stop flag of this binary trace
+		 writer.
+		 */
+		std::condition_variable m_stop_condition;
+
+		/**
+		 Flag indicating whether the background flusher of this binary trace
+		 writer must stop.
+		 */
+		bool m_stop;
+	};
+
+	//-------------------------------------------------------------------------
+	// BinaryTraceReader
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of binary trace readers decoding binary trace files in a single
+	 streaming pass (i.e. with memory usage independent of the file size,
+	 apart from the string table and per-thread state).
+	 */
+	class BinaryTraceReader
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a binary trace reader.
+
+		 @param[in]		fname
+						A reference to the path of the binary trace file.
+		 @param[in]		buffer_size
+						The read buffer size (in bytes).
+		 @note			If the file cannot be opened or has an invalid header,
+						no events are decoded (see @c IsOpen).
+		 */
+		explicit BinaryTraceReader(const std::filesystem::path& fname,
+								   std::size_t buffer_size
+								   = std::size_t(1u) << 20u);
+
+		/**
+		 Constructs a binary trace reader from the given binary trace reader.
+
+		 @param[in]		reader
+						A reference to the binary trace reader to copy.
+		 */
+		BinaryTraceReader(const BinaryTraceReader& reader) = delete;
+
+		/**
+		 Constructs a binary trace reader by moving the given binary trace
+		 reader.
+
+		 @param[in]		reader
+						A reference to the binary trace reader to move.
+		 */
+		BinaryTraceReader(BinaryTraceReader&& reader) = default;
+
+		/**
+		 Destructs this binary trace reader.
+		 */
+		~BinaryTraceReader() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given binary trace reader to this binary trace reader.
+
+		 @param[in]		reader
+						A reference to the binary trace reader to copy.
+		 @return		A reference to the copy of the given binary trace
+						reader (i.e. this binary trace reader).
+		 */
+		BinaryTraceReader& operator=(const BinaryTraceReader& reader) = delete;
+
+		/**
+		 Moves the given binary trace reader to this binary trace reader.
+
+		 @param[in]		reader
+						A reference to the binary trace reader to move.
+		 @return		A reference to the moved binary trace reader (i.e. this
+						binary trace reader).
+		 */
+		BinaryTraceReader& operator=(BinaryTraceReader&& reader) = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the file of this binary trace reader is open and has
+		 a valid header.
+
+		 @return		@c true if the file of this binary trace reader is
+						open and has a valid header. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOpen() const noexcept
+		{
+			return m_open;
+		}
+
+		/**
+		 Checks whether this binary trace reader encountered a malformed
+		 record.
+
+		 @return		@c true if this binary trace reader encountered a
+						malformed record. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasError() const noexcept
+		{
+			return m_error;
+		}
+
+		/**
+		 Returns the header of this binary trace reader.
+
+		 @return		A reference to the header of this binary trace reader.
+		 */
+		[[nodiscard]]
+		const BinaryTraceHeader& GetHeader() const noexcept
+		{
+			return m_header;
+		}
+
+		/**
+		 Decodes the next trace event.
+
+		 @param[out]	event
+						A reference to the decoded trace event.
+		 @return		@c true if a trace event is decoded. @c false if the
+						end of the file is reached or a malformed record is
+						encountered (see @c HasError).
+		 */
+		bool Next(BinaryTraceEvent& event);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the header of this binary trace reader.
+
+		 @return		@c true if the header is valid. @c false otherwise.
+		 */
+		bool ReadHeader();
+
+		/**
+		 Reads the next byte.
+
+		 @param[out]	value
+						A reference to the byte.
+		 @return		@c true if a byte is read. @c false if the end of the
+						file is reached.
+		 */
+		bool ReadByte(U8& value);
+
+		/**
+		 Reads the next varint.
+
+		 @param[out]	value
+						A reference to the varint.
+		 @return		@c true if a varint is read. @c false otherwise.
+		 */
+		bool ReadVarint(U64& value);
+
+		/**
+		 Reads the next string of the given length.
+
+		 @param[in]		length
+						The length of the string.
+		 @param[out]	str
+						A reference to the string.
+		 @return		@c true if the string is read. @c false otherwise.
+		 */
+		bool ReadString(U64 length, std::string& str);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The input file stream of this binary trace reader.
+		 */
+		std::ifstream m_stream;
+
+		/**
+		 The read buffer of this binary trace reader.
+		 */
+		std::vector< U8 > m_buffer;
+
+		/**
+		 The read position in the read buffer of this binary trace reader.
+		 */
+		std::size_t m_position;
+
+		/**
+		 The number of valid bytes in the read buffer of this binary trace
+		 reader.
+		 */
+		std::size_t m_size;
+
+		/**
+		 The header of this binary trace reader.
+		 */
+		BinaryTraceHeader m_header;
+
+		/**
+		 The string table of this binary trace reader (i.e. a deque, so the
+		 strings never move).
+		 */
+		std::deque< std::string > m_strings;
+
+		/**
+		 The previous timestamp per thread index of this binary trace
+		 reader.
+		 */
+		std::vector< U64 > m_previous_timestamps;
+
+		/**
+		 Flag indicating whether the file of this binary trace reader is
+		 open and has a valid header.
+		 */
+		bool m_open;
+
+		/**
+		 Flag indicating whether this binary trace reader encountered a
+		 malformed record.
+		 */
+		bool m_error;
+	};
+
+	//-------------------------------------------------------------------------
+	// Binary Trace Conversion
+	//-------------------------------------------------------------------------
+
+	/**
+	 Writes a summary (i.e. the count, total, minimum and maximum duration
+	 per zone name, sorted by total duration) of the remaining trace events
+	 of the given binary trace reader to the given output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in,out]	reader
+					A reference to the binary trace reader.
+	 @return		@c true if all trace events are decoded. @c false
+					otherwise.
+	 */
+	bool WriteBinaryTraceSummary(std::ostream& stream,
+								 BinaryTraceReader& reader);
+
+	/**
+	 Writes the remaining trace events of the given binary trace reader to
+	 the given output stream in the Chrome Trace Event JSON format.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in,out]	reader
+					A reference to the binary trace reader.
+	 @return		@c true if all trace events are decoded. @c false
+					otherwise.
+	 */
+	bool WriteBinaryTraceAsChromeJson(std::ostream& stream,
+									  BinaryTraceReader& reader);
+}
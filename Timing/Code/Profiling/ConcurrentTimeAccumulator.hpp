@@ -0,0 +1,413 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Timer
+#include <System/Timer.hpp>
+// U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// array
+#include <array>
+// atomic
+#include <atomic>
+// size_t
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// ConcurrentTimeAccumulator
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of concurrent time accumulators.
+
+	 Each thread adds its durations to its own cache-line-sized shard (i.e.
+	 a thread claims a free shard on first use and releases it on exit),
+	 avoiding both false sharing and a single contended atomic. Each shard
+	 has a single writer which brackets its relaxed stores with a sequence
+	 counter (i.e. a seqlock), so writers never wait and readers retry a
+	 shard whose sequence changed, resulting in a consistent total, count,
+	 minimum and maximum per shard without stopping writers.
+
+	 @note			Threads beyond the number of shards share an overflow
+					shard whose writers are serialized on its sequence
+					counter.
+	 @note			Durations added concurrently with a reset may be lost.
+
+	 @tparam		ClockT
+					The clock type.
+	 @tparam		ShardCountV
+					The number of (single-writer) shards.
+	 */
+	template< typename ClockT, std::size_t ShardCountV = 64u >
+	class ConcurrentTimeAccumulator
+	{
+
+		static_assert(0u < ShardCountV);
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time interval type of concurrent time accumulators.
+		 */
+		using TimeInterval = typename ClockT::duration;
+
+		/**
+		 A struct of statistics of concurrent time accumulators.
+		 */
+		struct Statistics
+		{
+			/**
+			 The total duration of these statistics.
+			 */
+			TimeInterval m_total = TimeInterval::zero();
+
+			/**
+			 The minimum duration of these statistics.
+			 */
+			TimeInterval m_min = TimeInterval::zero();
+
+			/**
+			 The maximum duration of these statistics.
+			 */
+			TimeInterval m_max = TimeInterval::zero();
+
+			/**
+			 The number of durations of these statistics.
+			 */
+			U64 m_count = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a concurrent time accumulator.
+		 */
+		ConcurrentTimeAccumulator() noexcept = default;
+
+		/**
+		 Constructs a concurrent time accumulator from the given concurrent
+		 time accumulator.
+
+		 @param[in]		accumulator
+						A reference to the concurrent time accumulator to
+						copy.
+		 */
+		ConcurrentTimeAccumulator(
+			const ConcurrentTimeAccumulator& accumulator) = delete;
+
+		/**
+		 Constructs a concurrent time accumulator by moving the given
+		 concurrent time accumulator.
+
+		 @param[in]		accumulator
+						A reference to the concurrent time accumulator to
+						move.
+		 */
+		ConcurrentTimeAccumulator(
+			ConcurrentTimeAccumulator&& accumulator) = delete;
+
+		/**
+		 Destructs this concurrent time accumulator.
+		 */
+		~ConcurrentTimeAccumulator() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given concurrent time accumulator to this concurrent time
+		 accumulator.
+
+		 @param[in]		accumulator
+						A reference to the concurrent time accumulator to
+						copy.
+		 @return		A reference to the copy of the given concurrent time
+						accumulator (i.e. this concurrent time accumulator).
+		 */
+		ConcurrentTimeAccumulator& operator=(
+			const ConcurrentTimeAccumulator& accumulator) = delete;
+
+		/**
+		 Moves the given concurrent time accumulator to this concurrent time
+		 accumulator.
+
+		 @param[in]		accumulator
+						A reference to the concurrent time accumulator to
+						move.
+		 @return		A reference to the moved concurrent time accumulator
+						(i.e. this concurrent time accumulator).
+		 */
+		ConcurrentTimeAccumulator& operator=(
+			ConcurrentTimeAccumulator&& accumulator) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given duration to this concurrent time accumulator.
+
+		 @param[in]		time_interval
+						The duration. Negative durations are added as zero.
+		 */
+		void Add(TimeInterval time_interval) noexcept;
+
+		/**
+		 Adds the delta time of the given timer to this concurrent time
+		 accumulator.
+
+		 @param[in,out]	timer
+						A reference to the timer.
+		 */
+		void Add(Timer< ClockT >& timer) noexcept;
+
+		/**
+		 Resets this concurrent time accumulator.
+		 */
+		void Reset() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the statistics of this concurrent time accumulator.
+
+		 @return		The statistics of this concurrent time accumulator.
+		 */
+		[[nodiscard]]
+		Statistics GetStatistics() const noexcept;
+
+		/**
+		 Returns the total duration of this concurrent time accumulator.
+
+		 @return		The total duration of this concurrent time
+						accumulator.
+		 */
+		[[nodiscard]]
+		TimeInterval GetTotal() const noexcept;
+
+		/**
+		 Returns the number of durations of this concurrent time
+		 accumulator.
+
+		 @return		The number of durations of this concurrent time
+						accumulator.
+		 */
+		[[nodiscard]]
+		U64 GetCount() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shards of concurrent time accumulators.
+		 */
+		struct alignas(64) Shard
+		{
+			/**
+			 The sequence number of this shard (odd while being written).
+			 */
+			std::atomic< U64 > m_sequence = 0u;
+
+			/**
+			 The reset generation of the members of this shard.
+			 */
+			std::atomic< U64 > m_generation = 0u;
+
+			/**
+			 The total number of ticks of this shard.
+			 */
+			std::atomic< U64 > m_total = 0u;
+
+			/**
+			 The minimum number of ticks of this shard.
+			 */
+			std::atomic< U64 > m_min = ~U64(0u);
+
+			/**
+			 The maximum number of ticks of this shard.
+			 */
+			std::atomic< U64 > m_max = 0u;
+
+			/**
+			 The number of durations of this shard.
+			 */
+			std::atomic< U64 > m_count = 0u;
+		};
+
+		/**
+		 A class of shard handles claiming a shard index for the lifetime of
+		 a thread.
+		 */
+		class ShardHandle
+		{
+
+		public:
+
+			/**
+			 Constructs a shard handle claiming a free shard index, or the
+			 index of the overflow shard if none is free.
+			 */
+			ShardHandle() noexcept;
+
+			/**
+			 Constructs a shard handle from the given shard handle.
+
+			 @param[in]		handle
+							A reference to the shard handle to copy.
+			 */
+			ShardHandle(const ShardHandle& handle) = delete;
+
+			/**
+			 Constructs a shard handle by moving the given shard handle.
+
+			 @param[in]		handle
+							A reference to the shard handle to move.
+			 */
+			ShardHandle(ShardHandle&& handle) = delete;
+
+			/**
+			 Destructs this shard handle releasing its shard index.
+			 */
+			~ShardHandle();
+
+			/**
+			 Copies the given shard handle to this shard handle.
+
+			 @param[in]		handle
+							A reference to the shard handle to copy.
+			 @return		A reference to the copy of the given shard handle
+							(i.e. this shard handle).
+			 */
+			ShardHandle& operator=(const ShardHandle& handle) = delete;
+
+			/**
+			 Moves the given shard handle to this shard handle.
+
+			 @param[in]		handle
+							A reference to the shard handle to move.
+			 @return		A reference to the moved shard handle (i.e. this
+							shard handle).
+			 */
+			ShardHandle& operator=(ShardHandle&& handle) = delete;
+
+			/**
+			 The shard index of this shard handle.
+			 */
+			const std::size_t m_index;
+
+		private:
+
+			/**
+			 Claims a free shard index.
+
+			 @return		The claimed shard index, or the index of the
+							overflow shard if none is free.
+			 */
+			[[nodiscard]]
+			static std::size_t Claim() noexcept;
+
+			/**
+			 The flags indicating which shard indices are claimed.
+			 */
+			static std::array< std::atomic< bool >, ShardCountV > s_claimed;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the overflow shard shared by threads beyond the number
+		 of shards.
+		 */
+		static constexpr std::size_t s_overflow_index = ShardCountV;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shard index of the calling thread.
+
+		 @return		The shard index of the calling thread.
+		 */
+		[[nodiscard]]
+		static std::size_t GetShardIndex() noexcept;
+
+		/**
+		 Converts the given number of ticks to a duration.
+
+		 @param[in]		ticks
+						The number of ticks.
+		 @return		The duration.
+		 */
+		[[nodiscard]]
+		static TimeInterval ToTimeInterval(U64 ticks) noexcept;
+
+		/**
+		 Begins writing the given shard.
+
+		 @param[in,out]	shard
+						A reference to the shard.
+		 @param[in]		shared
+						@c true if the shard has multiple writers. @c false
+						otherwise.
+		 @return		The (even) sequence number before writing.
+		 */
+		static U64 BeginWrite(Shard& shard, bool shared) noexcept;
+
+		/**
+		 Ends writing the given shard.
+
+		 @param[in,out]	shard
+						A reference to the shard.
+		 @param[in]		sequence
+						The sequence number returned by @c BeginWrite.
+		 */
+		static void EndWrite(Shard& shard, U64 sequence) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shards (followed by the overflow shard) of this concurrent time
+		 accumulator.
+		 */
+		std::array< Shard, ShardCountV + 1u > m_shards = {};
+
+		/**
+		 The reset generation of this concurrent time accumulator.
+		 */
+		std::atomic< U64 > m_generation = 0u;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Profiling/ConcurrentTimeAccumulator.inl>
@@ -0,0 +1,255 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max, min
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// ConcurrentTimeAccumulator
+	//-------------------------------------------------------------------------
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::Add(TimeInterval time_interval) noexcept
+	{
+		const auto ticks = (TimeInterval::zero() < time_interval)
+						 ? static_cast< U64 >(time_interval.count()) : 0u;
+
+		const auto generation = m_generation.load(std::memory_order_acquire);
+		const auto index      = GetShardIndex();
+		auto& shard           = m_shards[index];
+		const auto sequence   = BeginWrite(shard, s_overflow_index == index);
+
+		// No read-modify-writes are needed: each shard has a single writer
+		// at a time. A reset is applied lazily by that writer.
+		U64 total = 0u;
+		U64 min   = ~U64(0u);
+		U64 max   = 0u;
+		U64 count = 0u;
+		if (generation == shard.m_generation.load(std::memory_order_relaxed))
+		{
+			total = shard.m_total.load(std::memory_order_relaxed);
+			min   = shard.m_min.load(std::memory_order_relaxed);
+			max   = shard.m_max.load(std::memory_order_relaxed);
+			count = shard.m_count.load(std::memory_order_relaxed);
+		}
+		else
+		{
+			shard.m_generation.store(generation, std::memory_order_relaxed);
+		}
+
+		shard.m_total.store(total + ticks, std::memory_order_relaxed);
+		shard.m_min.store(std::min(min, ticks), std::memory_order_relaxed);
+		shard.m_max.store(std::max(max, ticks), std::memory_order_relaxed);
+		shard.m_count.store(count + 1u, std::memory_order_relaxed);
+
+		EndWrite(shard, sequence);
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::Add(Timer< ClockT >& timer) noexcept
+	{
+		Add(timer.template DeltaTime< TimeInterval >());
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::Reset() noexcept
+	{
+		// The shards of older generations are ignored by readers and cleared
+		// by their writers.
+		m_generation.fetch_add(1u, std::memory_order_acq_rel);
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	auto ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::GetStatistics() const noexcept -> Statistics
+	{
+		U64 total = 0u;
+		U64 min   = ~U64(0u);
+		U64 max   = 0u;
+		U64 count = 0u;
+
+		const auto generation = m_generation.load(std::memory_order_acquire);
+		for (const auto& shard : m_shards)
+		{
+			U64 shard_generation;
+			U64 shard_total;
+			U64 shard_min;
+			U64 shard_max;
+			U64 shard_count;
+
+			// Retries while the shard is (or was) being written.
+			for (;;)
+			{
+				const auto sequence
+					= shard.m_sequence.load(std::memory_order_acquire);
+				if (0u != (sequence & 1u))
+				{
+					continue;
+				}
+
+				shard_generation
+					= shard.m_generation.load(std::memory_order_relaxed);
+				shard_total = shard.m_total.load(std::memory_order_relaxed);
+				shard_min   = shard.m_min.load(std::memory_order_relaxed);
+				shard_max   = shard.m_max.load(std::memory_order_relaxed);
+				shard_count = shard.m_count.load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (sequence
+					== shard.m_sequence.load(std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+
+			if (generation != shard_generation)
+			{
+				continue;
+			}
+
+			if (0u == shard_count)
+			{
+				continue;
+			}
+
+			total += shard_total;
+			min    = std::min(min, shard_min);
+			max    = std::max(max, shard_max);
+			count += shard_count;
+		}
+
+		if (0u == count)
+		{
+			return {};
+		}
+
+		return
+		{
+			ToTimeInterval(total),
+			ToTimeInterval(min),
+			ToTimeInterval(max),
+			count
+		};
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline auto ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::GetTotal() const noexcept -> TimeInterval
+	{
+		return GetStatistics().m_total;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline U64 ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::GetCount() const noexcept
+	{
+		return GetStatistics().m_count;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline std::size_t ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::GetShardIndex() noexcept
+	{
+		thread_local const ShardHandle s_handle;
+		return s_handle.m_index;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline auto ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::ToTimeInterval(U64 ticks) noexcept -> TimeInterval
+	{
+		return TimeInterval(static_cast< typename TimeInterval::rep >(ticks));
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline U64 ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::BeginWrite(Shard& shard, bool shared) noexcept
+	{
+		auto sequence = shard.m_sequence.load(std::memory_order_relaxed);
+		if (shared)
+		{
+			// Serializes the writers of the overflow shard.
+			while (0u != (sequence & 1u)
+				   || !shard.m_sequence.compare_exchange_weak(
+					   sequence, sequence + 1u,
+					   std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				sequence = shard.m_sequence.load(std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			shard.m_sequence.store(sequence + 1u, std::memory_order_relaxed);
+		}
+
+		// Orders the odd sequence number before the member stores.
+		std::atomic_thread_fence(std::memory_order_release);
+		return sequence;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::EndWrite(Shard& shard, U64 sequence) noexcept
+	{
+		shard.m_sequence.store(sequence + 2u, std::memory_order_release);
+	}
+
+	//-------------------------------------------------------------------------
+	// ConcurrentTimeAccumulator::ShardHandle
+	//-------------------------------------------------------------------------
+
+	template< typename ClockT, std::size_t ShardCountV >
+	std::array< std::atomic< bool >, ShardCountV >
+		ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::ShardHandle::s_claimed = {};
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::ShardHandle::ShardHandle() noexcept
+		: m_index(Claim())
+	{}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::ShardHandle::~ShardHandle()
+	{
+		if (s_overflow_index != m_index)
+		{
+			// Publishes the stores of this thread to the next owner.
+			s_claimed[m_index].store(false, std::memory_order_release);
+		}
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	std::size_t ConcurrentTimeAccumulator< ClockT, ShardCountV >
+		::ShardHandle::Claim() noexcept
+	{
+		for (std::size_t i = 0u; i < ShardCountV; ++i)
+		{
+			if (!s_claimed[i].load(std::memory_order_relaxed)
+				&& !s_claimed[i].exchange(true, std::memory_order_acquire))
+			{
+				return i;
+			}
+		}
+
+		return s_overflow_index;
+	}
+}
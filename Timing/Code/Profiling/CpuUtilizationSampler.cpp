@@ -0,0 +1,248 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/CpuUtilizationSampler.hpp>
+// ProcessTimesClock, SystemTimeInterval
+#include <System/SystemTime.hpp>
+
+#ifdef _WIN32
+
+// GetCurrentThread, SetThreadPriority
+#include <System/Windows.hpp>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max
+#include <algorithm>
+
+#ifndef _WIN32
+
+// setpriority, PRIO_PROCESS
+#include <sys/resource.h>
+// syscall, SYS_gettid
+#include <sys/syscall.h>
+// id_t
+#include <sys/types.h>
+// syscall
+#include <unistd.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 Lowers the scheduling priority of the calling thread. The priority
+		 is lowered rather than set to idle, so sampling continues when all
+		 cores are busy.
+		 */
+		void LowerThreadPriority() noexcept
+		{
+#ifdef _WIN32
+			::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#else
+			// On Linux, the nice value is a per-thread attribute.
+			const auto tid = static_cast< id_t >(::syscall(SYS_gettid));
+			static_cast< void >(::setpriority(PRIO_PROCESS, tid, 19));
+#endif
+		}
+
+		/**
+		 Converts the given system time interval to seconds.
+
+		 @param[in]		time_interval
+						The duration.
+		 @return		The duration in seconds.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds ToSeconds(
+			SystemTimeInterval time_interval) noexcept
+		{
+			return std::chrono::duration_cast< TimeIntervalSeconds >(
+				time_interval);
+		}
+	}
+
+	CpuUtilizationSampler::CpuUtilizationSampler(std::size_t capacity)
+		: m_sample_mutex(),
+		m_samples(std::max(capacity, std::size_t(1u))),
+		m_next(0u),
+		m_count(0u),
+		m_sampler(),
+		m_stop_mutex(),
+		m_stop_condition(),
+		m_stop(false)
+	{}
+
+	CpuUtilizationSampler::~CpuUtilizationSampler()
+	{
+		Stop();
+	}
+
+	void CpuUtilizationSampler::Start(std::chrono::milliseconds period)
+	{
+		Stop();
+
+		{
+			const std::scoped_lock lock(m_sample_mutex);
+			m_next  = 0u;
+			m_count = 0u;
+		}
+
+		m_stop = false;
+		m_sampler = std::thread([this, period]()
+		{
+			LowerThreadPriority();
+			Run(period);
+		});
+	}
+
+	void CpuUtilizationSampler::Stop()
+	{
+		if (!m_sampler.joinable())
+		{
+			return;
+		}
+
+		{
+			const std::scoped_lock lock(m_stop_mutex);
+			m_stop = true;
+		}
+		m_stop_condition.notify_all();
+		m_sampler.join();
+	}
+
+	[[nodiscard]]
+	CpuUtilizationSample CpuUtilizationSampler::GetLatest() const
+	{
+		const std::scoped_lock lock(m_sample_mutex);
+
+		if (0u == m_count)
+		{
+			return {};
+		}
+
+		const auto capacity = m_samples.size();
+		return m_samples[(m_next + capacity - 1u) % capacity];
+	}
+
+	[[nodiscard]]
+	std::vector< CpuUtilizationSample >
+		CpuUtilizationSampler::GetSamples(TimeIntervalSeconds window) const
+	{
+		std::vector< CpuUtilizationSample > samples;
+
+		const std::scoped_lock lock(m_sample_mutex);
+
+		if (0u == m_count)
+		{
+			return samples;
+		}
+
+		const auto capacity = m_samples.size();
+		const auto latest
+			= m_samples[(m_next + capacity - 1u) % capacity].m_timestamp;
+
+		// Finds the oldest sample ending within the time window.
+		std::size_t count = 0u;
+		while (count < m_count)
+		{
+			const auto& sample
+				= m_samples[(m_next + capacity - 1u - count) % capacity];
+			if (window < latest - sample.m_timestamp)
+			{
+				break;
+			}
+
+			++count;
+		}
+
+		samples.reserve(count);
+		for (auto i = count; 0u != i; --i)
+		{
+			samples.push_back(m_samples[(m_next + capacity - i) % capacity]);
+		}
+
+		return samples;
+	}
+
+	[[nodiscard]]
+	CpuUtilizationSample CpuUtilizationSampler::GetMovingAverage(
+		TimeIntervalSeconds window) const
+	{
+		const auto samples = GetSamples(window);
+		if (samples.empty())
+		{
+			return {};
+		}
+
+		CpuUtilizationSample average;
+		average.m_timestamp = samples.back().m_timestamp;
+		for (const auto& sample : samples)
+		{
+			const auto weight = sample.m_interval.count();
+			average.m_interval    += sample.m_interval;
+			average.m_kernel_mode += weight * sample.m_kernel_mode;
+			average.m_user_mode   += weight * sample.m_user_mode;
+		}
+
+		if (TimeIntervalSeconds::zero() < average.m_interval)
+		{
+			const auto inv_interval = 1.0 / average.m_interval.count();
+			average.m_kernel_mode *= inv_interval;
+			average.m_user_mode   *= inv_interval;
+		}
+
+		return average;
+	}
+
+	void CpuUtilizationSampler::Run(std::chrono::milliseconds period)
+	{
+		const auto start    = ProcessTimesClock::now();
+		auto previous       = start;
+
+		std::unique_lock lock(m_stop_mutex);
+		while (!m_stop_condition.wait_for(lock, period,
+										  [this]() { return m_stop; }))
+		{
+			const auto current = ProcessTimesClock::now();
+
+			const auto wall = ToSeconds(current.m_wall - previous.m_wall);
+			if (TimeIntervalSeconds::zero() < wall)
+			{
+				const auto inv_wall = 1.0 / wall.count();
+
+				CpuUtilizationSample sample;
+				sample.m_timestamp   = ToSeconds(current.m_wall - start.m_wall);
+				sample.m_interval    = wall;
+				sample.m_kernel_mode = inv_wall * ToSeconds(
+					current.m_kernel_mode - previous.m_kernel_mode).count();
+				sample.m_user_mode   = inv_wall * ToSeconds(
+					current.m_user_mode   - previous.m_user_mode).count();
+
+				Add(sample);
+			}
+
+			previous = current;
+		}
+	}
+
+	void CpuUtilizationSampler::Add(const CpuUtilizationSample& sample)
+	{
+		const std::scoped_lock lock(m_sample_mutex);
+
+		m_samples[m_next] = sample;
+		m_next  = (m_next + 1u) % m_samples.size();
+		m_count = std::min(m_count + 1u, m_samples.size());
+	}
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TimeIntervalSeconds
+#include <System/Timer.hpp>
+// F64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// milliseconds
+#include <chrono>
+// condition_variable
+#include <condition_variable>
+// size_t
+#include <cstddef>
+// mutex
+#include <mutex>
+// thread
+#include <thread>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// CpuUtilizationSample
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of CPU utilization samples of the calling process. A
+	 utilization of 1 corresponds to one fully busy core.
+	 */
+	struct CpuUtilizationSample
+	{
+		/**
+		 Returns the (i.e. kernel and user mode) utilization of this CPU
+		 utilization sample.
+
+		 @return		The utilization of this CPU utilization sample.
+		 */
+		[[nodiscard]]
+		F64 GetUtilization() const noexcept
+		{
+			return m_kernel_mode + m_user_mode;
+		}
+
+		/**
+		 The wall clock time (since the start of the sampler) at the end of
+		 this CPU utilization sample.
+		 */
+		TimeIntervalSeconds m_timestamp = TimeIntervalSeconds::zero();
+
+		/**
+		 The wall clock time interval of this CPU utilization sample.
+		 */
+		TimeIntervalSeconds m_interval = TimeIntervalSeconds::zero();
+
+		/**
+		 The kernel mode utilization of this CPU utilization sample.
+		 */
+		F64 m_kernel_mode = 0.0;
+
+		/**
+		 The user mode utilization of this CPU utilization sample.
+		 */
+		F64 m_user_mode = 0.0;
+	};
+
+	//-------------------------------------------------------------------------
+	// CpuUtilizationSampler
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of CPU utilization samplers.
+
+	 A low-priority background thread samples the wall clock, kernel mode
+	 and user mode time of the calling process (i.e. a single
+	 @c ProcessTimesClock query per sample) at a fixed period into a
+	 fixed-size ring of samples. At the default period of 100 ms, the
+	 sampler costs a few microseconds of CPU time per second (i.e. well
+	 below 0.01%).
+	 */
+	class CpuUtilizationSampler
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a CPU utilization sampler.
+
+		 @param[in]		capacity
+						The maximum number of retained samples.
+		 */
+		explicit CpuUtilizationSampler(std::size_t capacity = 600u);
+
+		/**
+		 Constructs a CPU utilization sampler from the given CPU utilization
+		 sampler.
+
+		 @param[in]		sampler
+						A reference to the CPU utilization sampler to copy.
+		 */
+		CpuUtilizationSampler(const CpuUtilizationSampler& sampler) = delete;
+
+		/**
+		 Constructs a CPU utilization sampler by moving the given CPU
+		 utilization sampler.
+
+		 @param[in]		sampler
+						A reference to the CPU utilization sampler to move.
+		 */
+		CpuUtilizationSampler(CpuUtilizationSampler&& sampler) = delete;
+
+		/**
+		 Destructs this CPU utilization sampler.
+		 */
+		~CpuUtilizationSampler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given CPU utilization sampler to this CPU utilization
+		 sampler.
+
+		 @param[in]		sampler
+						A reference to the CPU utilization sampler to copy.
+		 @return		A reference to the copy of the given CPU utilization
+						sampler (i.e. this CPU utilization sampler).
+		 */
+		CpuUtilizationSampler& operator=(
+			const CpuUtilizationSampler& sampler) = delete;
+
+		/**
+		 Moves the given CPU utilization sampler to this CPU utilization
+		 sampler.
+
+		 @param[in]		sampler
+						A reference to the CPU utilization sampler to move.
+		 @return		A reference to the moved CPU utilization sampler (i.e.
+						this CPU utilization sampler).
+		 */
+		CpuUtilizationSampler& operator=(
+			CpuUtilizationSampler&& sampler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts sampling periodically on a background thread. All retained
+		 samples are discarded.
+
+		 @param[in]		period
+						The sample period.
+		 */
+		void Start(std::chrono::milliseconds period
+				   = std::chrono::milliseconds(100));
+
+		/**
+		 Stops sampling periodically on a background thread. The retained
+		 samples remain available.
+		 */
+		void Stop();
+
+		/**
+		 Returns the most recent sample of this CPU utilization sampler.
+
+		 @return		The most recent sample of this CPU utilization
+						sampler, or an empty sample if there are no samples.
+		 */
+		[[nodiscard]]
+		CpuUtilizationSample GetLatest() const;
+
+		/**
+		 Returns the retained samples of this CPU utilization sampler ending
+		 within the given (most recent) time window.
+
+		 @param[in]		window
+						The time window.
+		 @return		The samples ending within the given time window (in
+						chronological order).
+		 */
+		[[nodiscard]]
+		std::vector< CpuUtilizationSample >
+			GetSamples(TimeIntervalSeconds window) const;
+
+		/**
+		 Returns the average of the retained samples of this CPU utilization
+		 sampler ending within the given (most recent) time window. The
+		 samples are weighted by their wall clock time interval.
+
+		 @param[in]		window
+						The time window.
+		 @return		The average sample over the given time window (whose
+						timestamp is the one of the most recent sample and
+						whose interval is the sum of all intervals).
+		 */
+		[[nodiscard]]
+		CpuUtilizationSample GetMovingAverage(
+			TimeIntervalSeconds window) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Samples periodically until stopped.
+
+		 @param[in]		period
+						The sample period.
+		 */
+		void Run(std::chrono::milliseconds period);
+
+		/**
+		 Adds the given sample to this CPU utilization sampler.
+
+		 @param[in]		sample
+						A reference to the sample.
+		 */
+		void Add(const CpuUtilizationSample& sample);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The mutex guarding the samples of this CPU utilization sampler.
+		 */
+		mutable std::mutex m_sample_mutex;
+
+		/**
+		 The ring of samples of this CPU utilization sampler.
+		 */
+		std::vector< CpuUtilizationSample > m_samples;
+
+		/**
+		 The index of the next sample of this CPU utilization sampler.
+		 */
+		std::size_t m_next;
+
+		/**
+		 The number of retained samples of this CPU utilization sampler.
+		 */
+		std::size_t m_count;
+
+		/**
+		 The background sampler of this CPU utilization sampler.
+		 */
+		std::thread m_sampler;
+
+		/**
+		 The mutex guarding the stop flag of this CPU utilization sampler.
+		 */
+		std::mutex m_stop_mutex;
+
+		/**
+		 The condition variable signaling the stop flag of this CPU
+		 utilization sampler.
+		 */
+		std::condition_variable m_stop_condition;
+
+		/**
+		 Flag indicating whether the background sampler of this CPU
+		 utilization sampler must stop.
+		 */
+		bool m_stop;
+	};
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Timer
+#include <System/Timer.hpp>
+// F64, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// array
+#include <array>
+// atomic
+#include <atomic>
+// size_t
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// LatencyHistogram
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of latency histograms with a fixed memory footprint.
+
+	 Durations are recorded in raw ticks of the clock (i.e. without
+	 conversion to floating point) into log-linear buckets: each power of two
+	 range is subdivided in 2^(SubBucketBitsV - 1) linear buckets, resulting
+	 in a relative error below 2^(1 - SubBucketBitsV) independent of the
+	 number of recorded durations.
+
+	 Recording is lock-free and can be performed concurrently by multiple
+	 threads. Alternatively, each thread can record into its own latency
+	 histogram (i.e. shard) which are merged afterwards.
+
+	 @tparam		ClockT
+					The clock type.
+	 @tparam		SubBucketBitsV
+					The number of bits of the linear sub-buckets.
+	 */
+	template< typename ClockT, std::size_t SubBucketBitsV = 8u >
+	class LatencyHistogram
+	{
+
+		static_assert(2u <= SubBucketBitsV && SubBucketBitsV <= 16u);
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time interval type of latency histograms.
+		 */
+		using TimeInterval = typename ClockT::duration;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of linear sub-buckets per power of two range of latency
+		 histograms.
+		 */
+		static constexpr std::size_t s_half_sub_bucket_count
+			= std::size_t(1u) << (SubBucketBitsV - 1u);
+
+		/**
+		 The number of buckets of latency histograms.
+		 */
+		static constexpr std::size_t s_bucket_count
+			= (66u - SubBucketBitsV) * s_half_sub_bucket_count;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a latency histogram.
+		 */
+		LatencyHistogram() noexcept = default;
+
+		/**
+		 Constructs a latency histogram from the given latency histogram.
+
+		 @param[in]		histogram
+						A reference to the latency histogram to copy.
+		 */
+		LatencyHistogram(const LatencyHistogram& histogram) = delete;
+
+		/**
+		 Constructs a latency histogram by moving the given latency
+		 histogram.
+
+		 @param[in]		histogram
+						A reference to the latency histogram to move.
+		 */
+		LatencyHistogram(LatencyHistogram&& histogram) = delete;
+
+		/**
+		 Destructs this latency histogram.
+		 */
+		~LatencyHistogram() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given latency histogram to this latency histogram.
+
+		 @param[in]		histogram
+						A reference to the latency histogram to copy.
+		 @return		A reference to the copy of the given latency histogram
+						(i.e. this latency histogram).
+		 */
+		LatencyHistogram& operator=(
+			const LatencyHistogram& histogram) = delete;
+
+		/**
+		 Moves the given latency histogram to this latency histogram.
+
+		 @param[in]		histogram
+						A reference to the latency histogram to move.
+		 @return		A reference to the moved latency histogram (i.e. this
+						latency histogram).
+		 */
+		LatencyHistogram& operator=(LatencyHistogram&& histogram) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given duration in this latency histogram.
+
+		 @param[in]		time_interval
+						The duration. Negative durations are recorded as zero.
+		 */
+		void Record(TimeInterval time_interval) noexcept;
+
+		/**
+		 Records the delta time of the given timer in this latency histogram.
+
+		 @param[in,out]	timer
+						A reference to the timer.
+		 */
+		void Record(Timer< ClockT >& timer) noexcept;
+
+		/**
+		 Merges the given latency histogram into this latency histogram.
+
+		 @param[in]		histogram
+						A reference to the latency histogram to merge.
+		 */
+		void Merge(const LatencyHistogram& histogram) noexcept;
+
+		/**
+		 Moves the recorded durations of this latency histogram to the given
+		 latency histogram (i.e. reset-on-read for interval reporting).
+		 Concurrent recordings are either moved or retained.
+
+		 @param[in,out]	histogram
+						A reference to the latency histogram.
+		 */
+		void TransferTo(LatencyHistogram& histogram) noexcept;
+
+		/**
+		 Resets this latency histogram.
+		 */
+		void Reset() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of recorded durations of this latency histogram.
+
+		 @return		The number of recorded durations of this latency
+						histogram.
+		 */
+		[[nodiscard]]
+		U64 GetCount() const noexcept;
+
+		/**
+		 Returns the minimum recorded duration of this latency histogram.
+
+		 @return		The (lower bound of the bucket of the) minimum recorded
+						duration of this latency histogram.
+		 */
+		[[nodiscard]]
+		TimeInterval GetMin() const noexcept;
+
+		/**
+		 Returns the maximum recorded duration of this latency histogram.
+
+		 @return		The (upper bound of the bucket of the) maximum
+						recorded duration of this latency histogram.
+		 */
+		[[nodiscard]]
+		TimeInterval GetMax() const noexcept;
+
+		/**
+		 Returns the mean recorded duration of this latency histogram.
+
+		 @return		The exact mean recorded duration of this latency
+						histogram.
+		 */
+		[[nodiscard]]
+		TimeInterval GetMean() const noexcept;
+
+		/**
+		 Returns the duration at the given percentile of this latency
+		 histogram.
+
+		 @param[in]		percentile
+						The percentile in [0, 100] (e.g., 50, 99, 99.9).
+		 @return		The (upper bound of the bucket of the) duration at
+						the given percentile of this latency histogram.
+		 */
+		[[nodiscard]]
+		TimeInterval GetPercentile(F64 percentile) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the bucket index of the given number of ticks.
+
+		 @param[in]		ticks
+						The number of ticks.
+		 @return		The bucket index of the given number of ticks.
+		 */
+		[[nodiscard]]
+		static std::size_t GetBucketIndex(U64 ticks) noexcept;
+
+		/**
+		 Returns the lowest number of ticks of the bucket at the given index.
+
+		 @param[in]		index
+						The bucket index.
+		 @return		The lowest number of ticks of the bucket at the given
+						index.
+		 */
+		[[nodiscard]]
+		static U64 GetLowestTicks(std::size_t index) noexcept;
+
+		/**
+		 Returns the highest number of ticks of the bucket at the given
+		 index.
+
+		 @param[in]		index
+						The bucket index.
+		 @return		The highest number of ticks of the bucket at the given
+						index.
+		 */
+		[[nodiscard]]
+		static U64 GetHighestTicks(std::size_t index) noexcept;
+
+		/**
+		 Converts the given number of ticks to a duration.
+
+		 @param[in]		ticks
+						The number of ticks.
+		 @return		The duration.
+		 */
+		[[nodiscard]]
+		static TimeInterval ToTimeInterval(U64 ticks) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The counts of the buckets of this latency histogram.
+		 */
+		std::array< std::atomic< U64 >, s_bucket_count > m_counts = {};
+
+		/**
+		 The sum of the recorded ticks of this latency histogram.
+		 */
+		std::atomic< U64 > m_sum = 0u;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Profiling/LatencyHistogram.inl>
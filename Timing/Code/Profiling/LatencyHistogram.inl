@@ -0,0 +1,234 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// clamp, max
+#include <algorithm>
+// countl_zero
+#include <bit>
+// ceil
+#include <cmath>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	inline void LatencyHistogram< ClockT, SubBucketBitsV >
+		::Record(TimeInterval time_interval) noexcept
+	{
+		const auto ticks = (TimeInterval::zero() < time_interval)
+						 ? static_cast< U64 >(time_interval.count()) : 0u;
+
+		m_counts[GetBucketIndex(ticks)].fetch_add(1u,
+												  std::memory_order_relaxed);
+		m_sum.fetch_add(ticks, std::memory_order_relaxed);
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	inline void LatencyHistogram< ClockT, SubBucketBitsV >
+		::Record(Timer< ClockT >& timer) noexcept
+	{
+		Record(timer.template DeltaTime< TimeInterval >());
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	void LatencyHistogram< ClockT, SubBucketBitsV >
+		::Merge(const LatencyHistogram& histogram) noexcept
+	{
+		for (std::size_t i = 0u; i < s_bucket_count; ++i)
+		{
+			const auto count
+				= histogram.m_counts[i].load(std::memory_order_relaxed);
+			if (0u != count)
+			{
+				m_counts[i].fetch_add(count, std::memory_order_relaxed);
+			}
+		}
+
+		m_sum.fetch_add(histogram.m_sum.load(std::memory_order_relaxed),
+						std::memory_order_relaxed);
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	void LatencyHistogram< ClockT, SubBucketBitsV >
+		::TransferTo(LatencyHistogram& histogram) noexcept
+	{
+		for (std::size_t i = 0u; i < s_bucket_count; ++i)
+		{
+			if (0u == m_counts[i].load(std::memory_order_relaxed))
+			{
+				continue;
+			}
+
+			const auto count
+				= m_counts[i].exchange(0u, std::memory_order_relaxed);
+			histogram.m_counts[i].fetch_add(count, std::memory_order_relaxed);
+		}
+
+		histogram.m_sum.fetch_add(
+			m_sum.exchange(0u, std::memory_order_relaxed),
+			std::memory_order_relaxed);
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	void LatencyHistogram< ClockT, SubBucketBitsV >::Reset() noexcept
+	{
+		for (auto& count : m_counts)
+		{
+			count.store(0u, std::memory_order_relaxed);
+		}
+
+		m_sum.store(0u, std::memory_order_relaxed);
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	U64 LatencyHistogram< ClockT, SubBucketBitsV >::GetCount() const noexcept
+	{
+		U64 total = 0u;
+		for (const auto& count : m_counts)
+		{
+			total += count.load(std::memory_order_relaxed);
+		}
+
+		return total;
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	auto LatencyHistogram< ClockT, SubBucketBitsV >::GetMin() const noexcept
+		-> TimeInterval
+	{
+		for (std::size_t i = 0u; i < s_bucket_count; ++i)
+		{
+			if (0u != m_counts[i].load(std::memory_order_relaxed))
+			{
+				return ToTimeInterval(GetLowestTicks(i));
+			}
+		}
+
+		return TimeInterval::zero();
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	auto LatencyHistogram< ClockT, SubBucketBitsV >::GetMax() const noexcept
+		-> TimeInterval
+	{
+		for (auto i = s_bucket_count; 0u != i; --i)
+		{
+			if (0u != m_counts[i - 1u].load(std::memory_order_relaxed))
+			{
+				return ToTimeInterval(GetHighestTicks(i - 1u));
+			}
+		}
+
+		return TimeInterval::zero();
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	auto LatencyHistogram< ClockT, SubBucketBitsV >::GetMean() const noexcept
+		-> TimeInterval
+	{
+		const auto count = GetCount();
+		if (0u == count)
+		{
+			return TimeInterval::zero();
+		}
+
+		return ToTimeInterval(m_sum.load(std::memory_order_relaxed) / count);
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	auto LatencyHistogram< ClockT, SubBucketBitsV >
+		::GetPercentile(F64 percentile) const noexcept -> TimeInterval
+	{
+		std::array< U64, s_bucket_count > counts;
+		U64 total = 0u;
+		for (std::size_t i = 0u; i < s_bucket_count; ++i)
+		{
+			counts[i] = m_counts[i].load(std::memory_order_relaxed);
+			total += counts[i];
+		}
+
+		if (0u == total)
+		{
+			return TimeInterval::zero();
+		}
+
+		const auto fraction = std::clamp(percentile, 0.0, 100.0) * 0.01;
+		const auto rank = std::max(U64(1u), static_cast< U64 >(
+			std::ceil(fraction * static_cast< F64 >(total))));
+
+		U64 cumulative = 0u;
+		for (std::size_t i = 0u; i < s_bucket_count; ++i)
+		{
+			cumulative += counts[i];
+			if (rank <= cumulative)
+			{
+				return ToTimeInterval(GetHighestTicks(i));
+			}
+		}
+
+		return GetMax();
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	inline std::size_t LatencyHistogram< ClockT, SubBucketBitsV >
+		::GetBucketIndex(U64 ticks) noexcept
+	{
+		constexpr U64 sub_bucket_mask = 2u * s_half_sub_bucket_count - 1u;
+
+		// The shift is zero for ticks in the first (i.e. linear) range.
+		const auto msb   = 63u - std::countl_zero(ticks | sub_bucket_mask);
+		const auto shift = msb - (SubBucketBitsV - 1u);
+		return shift * s_half_sub_bucket_count
+			 + static_cast< std::size_t >(ticks >> shift);
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	inline U64 LatencyHistogram< ClockT, SubBucketBitsV >
+		::GetLowestTicks(std::size_t index) noexcept
+	{
+		if (index < 2u * s_half_sub_bucket_count)
+		{
+			return index;
+		}
+
+		const auto shift = index / s_half_sub_bucket_count - 1u;
+		const auto sub   = index - shift * s_half_sub_bucket_count;
+		return U64(sub) << shift;
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	inline U64 LatencyHistogram< ClockT, SubBucketBitsV >
+		::GetHighestTicks(std::size_t index) noexcept
+	{
+		if (index < 2u * s_half_sub_bucket_count)
+		{
+			return index;
+		}
+
+		const auto shift = index / s_half_sub_bucket_count - 1u;
+		const auto sub   = index - shift * s_half_sub_bucket_count;
+		// Wraps around to the maximum for the last bucket.
+		return (U64(sub + 1u) << shift) - 1u;
+	}
+
+	template< typename ClockT, std::size_t SubBucketBitsV >
+	[[nodiscard]]
+	inline auto LatencyHistogram< ClockT, SubBucketBitsV >
+		::ToTimeInterval(U64 ticks) noexcept -> TimeInterval
+	{
+		return TimeInterval(static_cast< typename TimeInterval::rep >(ticks));
+	}
+}
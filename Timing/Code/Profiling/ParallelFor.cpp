@@ -0,0 +1,449 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/ParallelFor.hpp>
+// GetEffectiveCoreCount
+#include <System/CoreCount.hpp>
+// WallThreadCpuTimer
+#include <System/MultiTimer.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max
+#include <algorithm>
+// high_resolution_clock
+#include <chrono>
+// condition_variable
+#include <condition_variable>
+// setprecision, setw
+#include <iomanip>
+// mutex
+#include <mutex>
+// ostream
+#include <ostream>
+// thread
+#include <thread>
+// move
+#include <utility>
+
+#ifdef _OPENMP
+
+// omp_get_num_threads, omp_get_thread_num
+#include <omp.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The clock type of parallel regions.
+		 */
+		using ParallelClock = std::chrono::high_resolution_clock;
+
+		/**
+		 A class of worker pools executing a task on a fixed number of
+		 workers. The calling thread is worker 0, the other workers are
+		 background threads kept alive between tasks.
+		 */
+		class WorkerPool
+		{
+
+		public:
+
+			/**
+			 Constructs a worker pool.
+			 */
+			WorkerPool() noexcept
+				: m_run_mutex(),
+				m_threads(),
+				m_mutex(),
+				m_start_condition(),
+				m_done_condition(),
+				m_task(nullptr),
+				m_generation(0u),
+				m_remaining(0u),
+				m_stop(false)
+			{}
+
+			/**
+			 Constructs a worker pool from the given worker pool.
+
+			 @param[in]		pool
+							A reference to the worker pool to copy.
+			 */
+			WorkerPool(const WorkerPool& pool) = delete;
+
+			/**
+			 Constructs a worker pool by moving the given worker pool.
+
+			 @param[in]		pool
+							A reference to the worker pool to move.
+			 */
+			WorkerPool(WorkerPool&& pool) = delete;
+
+			/**
+			 Destructs this worker pool.
+			 */
+			~WorkerPool()
+			{
+				StopThreads();
+			}
+
+			/**
+			 Copies the given worker pool to this worker pool.
+
+			 @param[in]		pool
+							A reference to the worker pool to copy.
+			 @return		A reference to the copy of the given worker pool
+							(i.e. this worker pool).
+			 */
+			WorkerPool& operator=(const WorkerPool& pool) = delete;
+
+			/**
+			 Moves the given worker pool to this worker pool.
+
+			 @param[in]		pool
+							A reference to the worker pool to move.
+			 @return		A reference to the moved worker pool (i.e. this
+							worker pool).
+			 */
+			WorkerPool& operator=(WorkerPool&& pool) = delete;
+
+			/**
+			 Executes the given task on the given number of workers and
+			 waits for all workers to finish.
+
+			 @param[in]		worker_count
+							The number of workers.
+			 @param[in]		task
+							A reference to the task taking the index of the
+							worker.
+			 */
+			void Run(std::size_t worker_count,
+					 const std::function< void(std::size_t) >& task)
+			{
+				const std::scoped_lock run_lock(m_run_mutex);
+
+				if (m_threads.size() + 1u != worker_count)
+				{
+					StopThreads();
+					StartThreads(worker_count - 1u);
+				}
+
+				{
+					const std::scoped_lock lock(m_mutex);
+					m_task      = &task;
+					m_remaining = m_threads.size();
+					++m_generation;
+				}
+				m_start_condition.notify_all();
+
+				task(0u);
+
+				std::unique_lock lock(m_mutex);
+				m_done_condition.wait(lock, [this]()
+				{
+					return 0u == m_remaining;
+				});
+				m_task = nullptr;
+			}
+
+		private:
+
+			/**
+			 Starts the given number of background threads.
+
+			 @param[in]		thread_count
+							The number of background threads.
+			 */
+			void StartThreads(std::size_t thread_count)
+			{
+				m_stop = false;
+				m_threads.reserve(thread_count);
+				for (std::size_t i = 0u; i < thread_count; ++i)
+				{
+					m_threads.emplace_back(&WorkerPool::Work, this, i + 1u,
+										   m_generation);
+				}
+			}
+
+			/**
+			 Stops and joins all background threads.
+			 */
+			void StopThreads()
+			{
+				{
+					const std::scoped_lock lock(m_mutex);
+					m_stop = true;
+				}
+				m_start_condition.notify_all();
+
+				for (auto& thread : m_threads)
+				{
+					thread.join();
+				}
+				m_threads.clear();
+			}
+
+			/**
+			 Executes the tasks of the given worker until stopped.
+
+			 @param[in]		worker
+							The index of the worker.
+			 @param[in]		generation
+							The generation of the last executed task.
+			 */
+			void Work(std::size_t worker, U64 generation)
+			{
+				while (true)
+				{
+					const std::function< void(std::size_t) >* task = nullptr;
+					{
+						std::unique_lock lock(m_mutex);
+						m_start_condition.wait(lock, [this, generation]()
+						{
+							return m_stop || generation != m_generation;
+						});
+						if (m_stop)
+						{
+							return;
+						}
+
+						generation = m_generation;
+						task       = m_task;
+					}
+
+					(*task)(worker);
+
+					{
+						const std::scoped_lock lock(m_mutex);
+						--m_remaining;
+					}
+					m_done_condition.notify_one();
+				}
+			}
+
+			/**
+			 The mutex serializing the tasks of this worker pool.
+			 */
+			std::mutex m_run_mutex;
+
+			/**
+			 The background threads of this worker pool.
+			 */
+			std::vector< std::thread > m_threads;
+
+			/**
+			 The mutex guarding the task state of this worker pool.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The condition variable signaling a new task or the stop flag of
+			 this worker pool.
+			 */
+			std::condition_variable m_start_condition;
+
+			/**
+			 The condition variable signaling finished background threads of
+			 this worker pool.
+			 */
+			std::condition_variable m_done_condition;
+
+			/**
+			 A pointer to the current task of this worker pool.
+			 */
+			const std::function< void(std::size_t) >* m_task;
+
+			/**
+			 The generation (i.e. the number of started tasks) of this worker
+			 pool.
+			 */
+			U64 m_generation;
+
+			/**
+			 The number of background threads still executing the current
+			 task of this worker pool.
+			 */
+			std::size_t m_remaining;
+
+			/**
+			 Flag indicating whether the background threads of this worker
+			 pool must stop.
+			 */
+			bool m_stop;
+		};
+
+		/**
+		 Returns the worker pool of the thread pool backend.
+
+		 @return		A reference to the worker pool of the thread pool
+						backend.
+		 */
+		[[nodiscard]]
+		WorkerPool& GetWorkerPool()
+		{
+			static WorkerPool pool;
+			return pool;
+		}
+
+		/**
+		 Converts the given time (in seconds) to milliseconds.
+
+		 @param[in]		time
+						The time.
+		 @return		The time in milliseconds.
+		 */
+		[[nodiscard]]
+		constexpr F64 ToMilliseconds(TimeIntervalSeconds time) noexcept
+		{
+			return 1e3 * time.count();
+		}
+	}
+
+	[[nodiscard]]
+	ParallelRegionStatistics
+		RunParallelRegion(const ParallelWorkerFunction& function,
+						  ParallelBackend backend,
+						  std::size_t thread_count)
+	{
+		const auto requested_count = (0u != thread_count)
+			? thread_count : std::max< std::size_t >(GetEffectiveCoreCount(),
+													  1u);
+
+		// Each worker records its times locally to avoid false sharing.
+		std::vector< ParallelWorkerTimes > workers(requested_count);
+		std::vector< ParallelClock::time_point > finishes(requested_count);
+		std::size_t worker_count = requested_count;
+
+		const auto start = ParallelClock::now();
+
+		const auto work = [&](std::size_t worker, std::size_t count)
+		{
+			ParallelWorkerTimes times;
+			times.m_start_delay = ParallelClock::now() - start;
+
+			WallThreadCpuTimer timer;
+			timer.Start();
+			function(worker, count, times);
+			timer.Stop();
+
+			const auto [busy_time, cpu_time]
+				= timer.DeltaTime< TimeIntervalSeconds >();
+			times.m_busy_time = busy_time;
+			times.m_cpu_time  = cpu_time;
+
+			finishes[worker] = ParallelClock::now();
+			workers[worker]  = times;
+		};
+
+#ifdef _OPENMP
+		if (ParallelBackend::OpenMP == backend)
+		{
+			const auto omp_thread_count = static_cast< int >(requested_count);
+			#pragma omp parallel num_threads(omp_thread_count)
+			{
+				const auto worker = static_cast< std::size_t >(
+					omp_get_thread_num());
+				const auto count  = static_cast< std::size_t >(
+					omp_get_num_threads());
+				if (0u == worker)
+				{
+					// OpenMP may provide fewer threads than requested.
+					worker_count = count;
+				}
+
+				work(worker, count);
+			}
+		}
+		else
+#else
+		static_cast< void >(backend);
+#endif
+		{
+			GetWorkerPool().Run(requested_count, [&work, requested_count](
+				std::size_t worker)
+			{
+				work(worker, requested_count);
+			});
+		}
+
+		const auto end = ParallelClock::now();
+
+		ParallelRegionStatistics statistics;
+		statistics.m_wall_time = end - start;
+		workers.resize(worker_count);
+
+		auto max_busy_time   = TimeIntervalSeconds::zero();
+		auto total_busy_time = TimeIntervalSeconds::zero();
+		auto total_cpu_time  = TimeIntervalSeconds::zero();
+		for (std::size_t i = 0u; i < worker_count; ++i)
+		{
+			auto& times = workers[i];
+			times.m_wait_time = end - finishes[i];
+
+			max_busy_time    = std::max(max_busy_time, times.m_busy_time);
+			total_busy_time += times.m_busy_time;
+			total_cpu_time  += times.m_cpu_time;
+		}
+
+		const auto count = static_cast< F64 >(worker_count);
+		if (TimeIntervalSeconds::zero() < total_busy_time)
+		{
+			statistics.m_imbalance = count * max_busy_time / total_busy_time;
+		}
+		if (TimeIntervalSeconds::zero() < statistics.m_wall_time)
+		{
+			statistics.m_efficiency
+				= total_cpu_time / (count * statistics.m_wall_time);
+		}
+
+		statistics.m_workers = std::move(workers);
+		return statistics;
+	}
+
+	void WriteParallelReport(std::ostream& stream,
+							 const ParallelRegionStatistics& statistics)
+	{
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << std::right << std::setw(8) << "Worker"
+			   << std::setw(14) << "Iterations"
+			   << std::setw(12) << "Start (ms)"
+			   << std::setw(12) << "Busy (ms)"
+			   << std::setw(12) << "Wait (ms)"
+			   << std::setw(12) << "CPU (ms)" << '\n';
+
+		stream << std::fixed << std::setprecision(3);
+		for (std::size_t i = 0u; i < statistics.m_workers.size(); ++i)
+		{
+			const auto& times = statistics.m_workers[i];
+			stream << std::setw(8)  << i
+				   << std::setw(14) << times.m_iteration_count
+				   << std::setw(12) << ToMilliseconds(times.m_start_delay)
+				   << std::setw(12) << ToMilliseconds(times.m_busy_time)
+				   << std::setw(12) << ToMilliseconds(times.m_wait_time)
+				   << std::setw(12) << ToMilliseconds(times.m_cpu_time)
+				   << '\n';
+		}
+
+		stream << "Wall (ms): " << ToMilliseconds(statistics.m_wall_time)
+			   << std::setprecision(2)
+			   << "  Imbalance (max/mean busy): " << statistics.m_imbalance
+			   << "  Efficiency (CPU/(wall x workers)): "
+			   << statistics.m_efficiency << '\n';
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+}
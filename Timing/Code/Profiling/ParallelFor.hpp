@@ -0,0 +1,247 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TimeIntervalSeconds
+#include <System/Timer.hpp>
+// F64, U32, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// size_t
+#include <cstddef>
+// int64_t
+#include <cstdint>
+// function
+#include <functional>
+// ostream
+#include <iosfwd>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Parallel Region Options
+	//-------------------------------------------------------------------------
+
+	/**
+	 An enumeration of the different backends of parallel regions.
+	 */
+	enum class ParallelBackend : U32
+	{
+		ThreadPool = 0u,
+		OpenMP     = 1u
+	};
+
+	/**
+	 An enumeration of the different schedules of parallel loops.
+	 */
+	enum class ParallelSchedule : U32
+	{
+		/**
+		 Chunks are assigned round-robin to the workers up front (i.e.
+		 OpenMP's @c schedule(static, chunk_size)).
+		 */
+		Static  = 0u,
+
+		/**
+		 Chunks are claimed by idle workers (i.e. OpenMP's
+		 @c schedule(dynamic, chunk_size)).
+		 */
+		Dynamic = 1u
+	};
+
+	/**
+	 A struct of parallel loop options.
+	 */
+	struct ParallelForOptions
+	{
+		/**
+		 The backend executing the parallel region.
+		 */
+		ParallelBackend m_backend = ParallelBackend::OpenMP;
+
+		/**
+		 The schedule distributing the iterations over the workers.
+		 */
+		ParallelSchedule m_schedule = ParallelSchedule::Static;
+
+		/**
+		 The number of consecutive iterations per chunk.
+		 */
+		std::size_t m_chunk_size = 1u;
+
+		/**
+		 The number of workers, or zero to use the effective number of cores
+		 (see @c GetEffectiveCoreCount).
+		 */
+		std::size_t m_thread_count = 0u;
+	};
+
+	//-------------------------------------------------------------------------
+	// Parallel Region Statistics
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of the times of a single worker of a parallel region. The start
+	 delay, busy time and wait time of a worker add up to the wall clock time
+	 of the parallel region.
+	 */
+	struct ParallelWorkerTimes
+	{
+		/**
+		 The number of iterations executed by this worker.
+		 */
+		U64 m_iteration_count = 0u;
+
+		/**
+		 The wall clock time between entering the parallel region and this
+		 worker starting its work (i.e. the fork overhead).
+		 */
+		TimeIntervalSeconds m_start_delay = TimeIntervalSeconds::zero();
+
+		/**
+		 The wall clock time this worker spent executing its iterations.
+		 */
+		TimeIntervalSeconds m_busy_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The wall clock time this worker spent waiting at the barrier for the
+		 other workers to finish.
+		 */
+		TimeIntervalSeconds m_wait_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The CPU (i.e. thread core clock) time this worker spent executing
+		 its iterations.
+		 */
+		TimeIntervalSeconds m_cpu_time = TimeIntervalSeconds::zero();
+	};
+
+	/**
+	 A struct of statistics of parallel regions.
+	 */
+	struct ParallelRegionStatistics
+	{
+		/**
+		 The times of each worker of the parallel region.
+		 */
+		std::vector< ParallelWorkerTimes > m_workers;
+
+		/**
+		 The wall clock time of the parallel region.
+		 */
+		TimeIntervalSeconds m_wall_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The load imbalance (i.e. the ratio of the maximum to the mean busy
+		 time of the workers: 1 if all workers are equally busy, and the
+		 number of workers if only one worker is busy).
+		 */
+		F64 m_imbalance = 0.0;
+
+		/**
+		 The parallel efficiency (i.e. the ratio of the total CPU time of the
+		 workers to the product of the wall clock time and the number of
+		 workers: 1 if all workers are busy during the whole region).
+		 */
+		F64 m_efficiency = 0.0;
+	};
+
+	//-------------------------------------------------------------------------
+	// Parallel Regions
+	//-------------------------------------------------------------------------
+
+	/**
+	 A worker function type executing the work of a single worker of a
+	 parallel region.
+
+	 @param[in]		worker
+					The index of the worker.
+	 @param[in]		worker_count
+					The number of workers.
+	 @param[in,out]	times
+					A reference to the times of the worker to update with the
+					number of executed iterations.
+	 */
+	using ParallelWorkerFunction
+		= std::function< void(std::size_t worker,
+							  std::size_t worker_count,
+							  ParallelWorkerTimes& times) >;
+
+	/**
+	 Executes the given worker function on each worker of an instrumented
+	 parallel region, recording the start delay, busy time, barrier wait
+	 time and CPU time of each worker.
+
+	 @param[in]		function
+					A reference to the worker function.
+	 @param[in]		backend
+					The backend executing the parallel region.
+	 @param[in]		thread_count
+					The number of workers, or zero to use the effective
+					number of cores.
+	 @return		The statistics of the parallel region.
+	 @note			The thread pool backend runs the calling thread as worker
+					0 and keeps its other workers alive between regions.
+					Its parallel regions are serialized and must not be
+					nested.
+	 @note			The OpenMP backend falls back to the thread pool backend
+					if OpenMP is not enabled.
+	 */
+	[[nodiscard]]
+	ParallelRegionStatistics
+		RunParallelRegion(const ParallelWorkerFunction& function,
+						  ParallelBackend backend,
+						  std::size_t thread_count = 0u);
+
+	/**
+	 Executes the given function for each index in the given range in an
+	 instrumented parallel region.
+
+	 @tparam		FunctionT
+					The function type.
+	 @param[in]		begin
+					The first index.
+	 @param[in]		end
+					The index past the last index.
+	 @param[in]		function
+					A reference to the function taking an index.
+	 @param[in]		options
+					A reference to the parallel loop options.
+	 @return		The statistics of the parallel region.
+	 */
+	template< typename FunctionT >
+	[[nodiscard]]
+	ParallelRegionStatistics ParallelFor(std::int64_t begin,
+										 std::int64_t end,
+										 const FunctionT& function,
+										 const ParallelForOptions& options
+										 = {});
+
+	/**
+	 Writes the given parallel region statistics as a table to the given
+	 output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		statistics
+					A reference to the parallel region statistics.
+	 */
+	void WriteParallelReport(std::ostream& stream,
+							 const ParallelRegionStatistics& statistics);
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Profiling/ParallelFor.inl>
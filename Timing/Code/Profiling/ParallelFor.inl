@@ -0,0 +1,71 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max, min
+#include <algorithm>
+// atomic
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename FunctionT >
+	[[nodiscard]]
+	inline ParallelRegionStatistics
+		ParallelFor(std::int64_t begin, std::int64_t end,
+					const FunctionT& function,
+					const ParallelForOptions& options)
+	{
+		const auto chunk_size  = static_cast< std::int64_t >(
+			std::max< std::size_t >(options.m_chunk_size, 1u));
+		const auto count       = std::max< std::int64_t >(end - begin, 0);
+		const auto chunk_count = (count + chunk_size - 1) / chunk_size;
+
+		// The next chunk claimed by an idle worker (dynamic schedule).
+		std::atomic< std::int64_t > next_chunk = 0;
+
+		const auto execute_chunk = [&](std::int64_t chunk)
+		{
+			const auto first = begin + chunk * chunk_size;
+			const auto last  = std::min(first + chunk_size, end);
+			for (auto i = first; i < last; ++i)
+			{
+				function(i);
+			}
+			return static_cast< U64 >(last - first);
+		};
+
+		return RunParallelRegion(
+			[&](std::size_t worker, std::size_t worker_count,
+				ParallelWorkerTimes& times)
+			{
+				if (ParallelSchedule::Static == options.m_schedule)
+				{
+					const auto stride = static_cast< std::int64_t >(
+						worker_count);
+					for (auto chunk = static_cast< std::int64_t >(worker);
+						 chunk < chunk_count; chunk += stride)
+					{
+						times.m_iteration_count += execute_chunk(chunk);
+					}
+				}
+				else
+				{
+					for (auto chunk = next_chunk.fetch_add(
+							 1, std::memory_order_relaxed);
+						 chunk < chunk_count;
+						 chunk = next_chunk.fetch_add(
+							 1, std::memory_order_relaxed))
+					{
+						times.m_iteration_count += execute_chunk(chunk);
+					}
+				}
+			},
+			options.m_backend, options.m_thread_count);
+	}
+}
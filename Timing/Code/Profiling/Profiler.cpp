@@ -0,0 +1,374 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/Profiler.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// find, max, min
+#include <algorithm>
+// duration, duration_cast
+#include <chrono>
+// fixed, left, right, setprecision, setw
+#include <iomanip>
+// mutex, scoped_lock
+#include <mutex>
+// ostream
+#include <ostream>
+// pair
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		//---------------------------------------------------------------------
+		// Registry
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of registries of thread profilers.
+		 */
+		struct Registry
+		{
+			/**
+			 The mutex guarding this registry.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The registered thread profilers of this registry.
+			 */
+			std::vector< ThreadProfiler* > m_profilers;
+
+			/**
+			 The merged profile tree of the retired thread profilers of this
+			 registry.
+			 */
+			ProfileTree m_retired;
+		};
+
+		/**
+		 Returns the registry of thread profilers.
+
+		 @return		A reference to the registry of thread profilers.
+		 */
+		[[nodiscard]]
+		Registry& GetRegistry()
+		{
+			static Registry s_registry;
+			return s_registry;
+		}
+
+		/**
+		 Converts the given number of ticks to a time interval.
+
+		 @param[in]		ticks
+						The number of ticks.
+		 @return		The time interval corresponding to the given number
+						of ticks.
+		 */
+		[[nodiscard]]
+		inline TimeIntervalSeconds ToTimeInterval(U64 ticks) noexcept
+		{
+			using Duration = ThreadProfiler::ClockType::duration;
+			return std::chrono::duration_cast< TimeIntervalSeconds >(
+				Duration(static_cast< Duration::rep >(ticks)));
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// ProfileStatistics
+	//-------------------------------------------------------------------------
+
+	void ProfileStatistics::Merge(const ProfileStatistics& statistics) noexcept
+	{
+		if (0u == statistics.m_call_count)
+		{
+			return;
+		}
+
+		if (0u == m_call_count)
+		{
+			m_min_time = statistics.m_min_time;
+			m_max_time = statistics.m_max_time;
+		}
+		else
+		{
+			m_min_time = std::min(m_min_time, statistics.m_min_time);
+			m_max_time = std::max(m_max_time, statistics.m_max_time);
+		}
+
+		m_call_count     += statistics.m_call_count;
+		m_inclusive_time += statistics.m_inclusive_time;
+		m_exclusive_time += statistics.m_exclusive_time;
+	}
+
+	//-------------------------------------------------------------------------
+	// ProfileTree
+	//-------------------------------------------------------------------------
+
+	ProfileTree::ProfileTree()
+		: m_nodes(1u)
+	{}
+
+	std::size_t ProfileTree::AddZone(std::size_t parent, std::string_view name)
+	{
+		for (const auto child : m_nodes[parent].m_children)
+		{
+			if (m_nodes[child].m_name == name)
+			{
+				return child;
+			}
+		}
+
+		const auto child = m_nodes.size();
+		auto& node = m_nodes.emplace_back();
+		node.m_name   = name;
+		node.m_parent = parent;
+		m_nodes[parent].m_children.push_back(child);
+		return child;
+	}
+
+	void ProfileTree::AddStatistics(
+		std::size_t index, const ProfileStatistics& statistics) noexcept
+	{
+		m_nodes[index].m_statistics.Merge(statistics);
+	}
+
+	void ProfileTree::Merge(const ProfileTree& tree)
+	{
+		Merge(tree, s_root, s_root);
+	}
+
+	void ProfileTree::Merge(const ProfileTree& tree,
+							std::size_t src,
+							std::size_t dst)
+	{
+		const auto& node = tree.m_nodes[src];
+		AddStatistics(dst, node.m_statistics);
+
+		for (const auto child : node.m_children)
+		{
+			const auto index = AddZone(dst, tree.m_nodes[child].m_name);
+			Merge(tree, child, index);
+		}
+	}
+
+	void ProfileTree::Dump(std::ostream& stream) const
+	{
+		stream << std::left  << std::setw(40) << "Zone"
+			   << std::right << std::setw(10) << "Calls"
+			   << std::setw(14) << "Incl. (ms)"
+			   << std::setw(14) << "Excl. (ms)"
+			   << std::setw(12) << "Min (ms)"
+			   << std::setw(12) << "Max (ms)" << '\n';
+
+		for (const auto child : m_nodes[s_root].m_children)
+		{
+			Dump(stream, child, 0u);
+		}
+	}
+
+	void ProfileTree::Dump(std::ostream& stream,
+						   std::size_t index,
+						   std::size_t depth) const
+	{
+		using Milliseconds = std::chrono::duration< F64, std::milli >;
+		const auto ms = [](TimeIntervalSeconds time) noexcept
+		{
+			return std::chrono::duration_cast< Milliseconds >(time).count();
+		};
+
+		const auto& node = m_nodes[index];
+		const auto& statistics = node.m_statistics;
+
+		stream << std::left  << std::setw(40)
+			   << (std::string(2u * depth, ' ') + node.m_name)
+			   << std::right << std::setw(10) << statistics.m_call_count
+			   << std::fixed << std::setprecision(3)
+			   << std::setw(14) << ms(statistics.m_inclusive_time)
+			   << std::setw(14) << ms(statistics.m_exclusive_time)
+			   << std::setw(12) << ms(statistics.m_min_time)
+			   << std::setw(12) << ms(statistics.m_max_time) << '\n';
+
+		for (const auto child : node.m_children)
+		{
+			Dump(stream, child, depth + 1u);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// ThreadProfiler
+	//-------------------------------------------------------------------------
+
+	ThreadProfiler::ThreadProfiler()
+		: m_nodes(std::make_unique< Node[] >(s_node_capacity)),
+		m_node_count(2u),
+		m_frames(std::make_unique< Frame[] >(s_max_depth))
+	{
+		m_nodes[s_root].m_name       = "";
+		m_nodes[s_overflow].m_name   = "[overflow]";
+		m_nodes[s_overflow].m_parent = s_invalid;
+
+		auto& registry = GetRegistry();
+		const std::scoped_lock lock(registry.m_mutex);
+		registry.m_profilers.push_back(this);
+	}
+
+	ThreadProfiler::~ThreadProfiler()
+	{
+		auto tree = GetProfileTree();
+
+		auto& registry = GetRegistry();
+		const std::scoped_lock lock(registry.m_mutex);
+		const auto it = std::find(registry.m_profilers.begin(),
+								  registry.m_profilers.end(), this);
+		if (registry.m_profilers.end() != it)
+		{
+			registry.m_profilers.erase(it);
+		}
+		registry.m_retired.Merge(tree);
+	}
+
+	[[nodiscard]]
+	U32 ThreadProfiler::AllocateChild(U32 parent, const char* name) noexcept
+	{
+		if (s_node_capacity == m_node_count)
+		{
+			auto& overflow = m_nodes[s_overflow];
+			if (s_invalid == overflow.m_parent)
+			{
+				// Links the overflow node to the root on first use.
+				auto& root = m_nodes[s_root];
+				overflow.m_parent       = s_root;
+				overflow.m_next_sibling
+					= root.m_first_child.load(std::memory_order_relaxed);
+				root.m_first_child.store(s_overflow, std::memory_order_release);
+			}
+
+			return s_overflow;
+		}
+
+		const auto child = m_node_count++;
+		auto& node = m_nodes[child];
+		node.m_name         = name;
+		node.m_parent       = parent;
+		node.m_next_sibling
+			= m_nodes[parent].m_first_child.load(std::memory_order_relaxed);
+
+		// Publishes the node to concurrent readers.
+		m_nodes[parent].m_first_child.store(child, std::memory_order_release);
+		return child;
+	}
+
+	void ThreadProfiler::ResetStatistics() noexcept
+	{
+		m_reset_requested.store(false, std::memory_order_relaxed);
+
+		for (U32 i = 0u; i < m_node_count; ++i)
+		{
+			auto& node = m_nodes[i];
+			node.m_call_count.store(0u, std::memory_order_relaxed);
+			node.m_inclusive_ticks.store(0u, std::memory_order_relaxed);
+			node.m_exclusive_ticks.store(0u, std::memory_order_relaxed);
+			node.m_min_ticks.store(0u, std::memory_order_relaxed);
+			node.m_max_ticks.store(0u, std::memory_order_relaxed);
+		}
+	}
+
+	[[nodiscard]]
+	ProfileTree ThreadProfiler::GetProfileTree() const
+	{
+		ProfileTree tree;
+
+		// Depth-first traversal of the published nodes.
+		std::vector< std::pair< U32, std::size_t > > stack;
+		stack.emplace_back(s_root, ProfileTree::s_root);
+		while (!stack.empty())
+		{
+			const auto [src, dst] = stack.back();
+			stack.pop_back();
+
+			auto child = m_nodes[src].m_first_child.load(
+				std::memory_order_acquire);
+			while (s_invalid != child)
+			{
+				const auto& node = m_nodes[child];
+
+				ProfileStatistics statistics;
+				statistics.m_call_count = node.m_call_count.load(
+					std::memory_order_relaxed);
+				statistics.m_inclusive_time = ToTimeInterval(
+					node.m_inclusive_ticks.load(std::memory_order_relaxed));
+				statistics.m_exclusive_time = ToTimeInterval(
+					node.m_exclusive_ticks.load(std::memory_order_relaxed));
+				statistics.m_min_time = ToTimeInterval(
+					node.m_min_ticks.load(std::memory_order_relaxed));
+				statistics.m_max_time = ToTimeInterval(
+					node.m_max_ticks.load(std::memory_order_relaxed));
+
+				const auto index = tree.AddZone(dst, node.m_name);
+				tree.AddStatistics(index, statistics);
+				stack.emplace_back(child, index);
+
+				child = node.m_next_sibling;
+			}
+		}
+
+		return tree;
+	}
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	std::vector< ProfileTree > CollectThreadProfileTrees()
+	{
+		auto& registry = GetRegistry();
+		const std::scoped_lock lock(registry.m_mutex);
+
+		std::vector< ProfileTree > trees;
+		trees.reserve(registry.m_profilers.size() + 1u);
+		for (const auto profiler : registry.m_profilers)
+		{
+			trees.push_back(profiler->GetProfileTree());
+		}
+		trees.push_back(registry.m_retired);
+
+		return trees;
+	}
+
+	[[nodiscard]]
+	ProfileTree CollectProfileTree()
+	{
+		ProfileTree merged;
+		for (const auto& tree : CollectThreadProfileTrees())
+		{
+			merged.Merge(tree);
+		}
+
+		return merged;
+	}
+
+	void ResetProfileTrees()
+	{
+		auto& registry = GetRegistry();
+		const std::scoped_lock lock(registry.m_mutex);
+
+		for (const auto profiler : registry.m_profilers)
+		{
+			// Only the owning thread resets its statistics.
+			profiler->RequestReset();
+		}
+		registry.m_retired = {};
+	}
+}
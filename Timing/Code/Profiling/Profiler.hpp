@@ -0,0 +1,757 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TimeIntervalSeconds, Timer
+#include <System/Timer.hpp>
+// U32, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// atomic
+#include <atomic>
+// high_resolution_clock
+#include <chrono>
+// size_t
+#include <cstddef>
+// ostream
+#include <iosfwd>
+// unique_ptr
+#include <memory>
+// string
+#include <string>
+// string_view
+#include <string_view>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// ProfileStatistics
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of profile statistics of a zone.
+	 */
+	struct ProfileStatistics
+	{
+		/**
+		 Merges the given profile statistics into these profile statistics.
+
+		 @param[in]		statistics
+						A reference to the profile statistics to merge.
+		 */
+		void Merge(const ProfileStatistics& statistics) noexcept;
+
+		/**
+		 The number of calls of the zone.
+		 */
+		U64 m_call_count = 0u;
+
+		/**
+		 The inclusive (i.e. including the child zones) time of the zone.
+		 */
+		TimeIntervalSeconds m_inclusive_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The exclusive (i.e. excluding the child zones) time of the zone.
+		 */
+		TimeIntervalSeconds m_exclusive_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The minimum inclusive time of a single call of the zone.
+		 */
+		TimeIntervalSeconds m_min_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The maximum inclusive time of a single call of the zone.
+		 */
+		TimeIntervalSeconds m_max_time = TimeIntervalSeconds::zero();
+	};
+
+	//-------------------------------------------------------------------------
+	// ProfileTree
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of profile tree nodes.
+	 */
+	struct ProfileTreeNode
+	{
+		/**
+		 The name of the zone of this profile tree node.
+		 */
+		std::string m_name;
+
+		/**
+		 The index of the parent node of this profile tree node.
+		 */
+		std::size_t m_parent = 0u;
+
+		/**
+		 The indices of the child nodes of this profile tree node.
+		 */
+		std::vector< std::size_t > m_children;
+
+		/**
+		 The profile statistics of this profile tree node.
+		 */
+		ProfileStatistics m_statistics;
+	};
+
+	/**
+	 A class of profile trees (i.e. call trees of zones).
+	 */
+	class ProfileTree
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the root node of profile trees.
+		 */
+		static constexpr std::size_t s_root = 0u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profile tree containing only a root node.
+		 */
+		ProfileTree();
+
+		/**
+		 Constructs a profile tree from the given profile tree.
+
+		 @param[in]		tree
+						A reference to the profile tree to copy.
+		 */
+		ProfileTree(const ProfileTree& tree) = default;
+
+		/**
+		 Constructs a profile tree by moving the given profile tree.
+
+		 @param[in]		tree
+						A reference to the profile tree to move.
+		 */
+		ProfileTree(ProfileTree&& tree) noexcept = default;
+
+		/**
+		 Destructs this profile tree.
+		 */
+		~ProfileTree() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profile tree to this profile tree.
+
+		 @param[in]		tree
+						A reference to the profile tree to copy.
+		 @return		A reference to the copy of the given profile tree
+						(i.e. this profile tree).
+		 */
+		ProfileTree& operator=(const ProfileTree& tree) = default;
+
+		/**
+		 Moves the given profile tree to this profile tree.
+
+		 @param[in]		tree
+						A reference to the profile tree to move.
+		 @return		A reference to the moved profile tree (i.e. this
+						profile tree).
+		 */
+		ProfileTree& operator=(ProfileTree&& tree) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of nodes of this profile tree.
+
+		 @return		The number of nodes of this profile tree.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfNodes() const noexcept
+		{
+			return m_nodes.size();
+		}
+
+		/**
+		 Returns the node at the given index of this profile tree.
+
+		 @param[in]		index
+						The index.
+		 @return		A reference to the node at the given index of this
+						profile tree.
+		 */
+		[[nodiscard]]
+		const ProfileTreeNode& GetNode(std::size_t index) const noexcept
+		{
+			return m_nodes[index];
+		}
+
+		/**
+		 Returns the index of the child node of the given parent node with
+		 the given name, adding that child node if not present.
+
+		 @param[in]		parent
+						The index of the parent node.
+		 @param[in]		name
+						The name of the zone of the child node.
+		 @return		The index of the child node.
+		 */
+		std::size_t AddZone(std::size_t parent, std::string_view name);
+
+		/**
+		 Merges the given profile statistics into the node at the given index
+		 of this profile tree.
+
+		 @param[in]		index
+						The index.
+		 @param[in]		statistics
+						A reference to the profile statistics to merge.
+		 */
+		void AddStatistics(std::size_t index,
+						   const ProfileStatistics& statistics) noexcept;
+
+		/**
+		 Merges the given profile tree into this profile tree. Nodes are
+		 matched by the names of the zones along their path from the root.
+
+		 @param[in]		tree
+						A reference to the profile tree to merge.
+		 */
+		void Merge(const ProfileTree& tree);
+
+		/**
+		 Writes this profile tree as an indented table to the given output
+		 stream.
+
+		 @param[in,out]	stream
+						A reference to the output stream.
+		 */
+		void Dump(std::ostream& stream) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Merges the subtree at the given index of the given profile tree into
+		 the subtree at the given index of this profile tree.
+
+		 @param[in]		tree
+						A reference to the profile tree to merge.
+		 @param[in]		src
+						The index of the subtree of the given profile tree.
+		 @param[in]		dst
+						The index of the subtree of this profile tree.
+		 */
+		void Merge(const ProfileTree& tree, std::size_t src, std::size_t dst);
+
+		/**
+		 Writes the subtree at the given index of this profile tree to the
+		 given output stream.
+
+		 @param[in,out]	stream
+						A reference to the output stream.
+		 @param[in]		index
+						The index of the subtree.
+		 @param[in]		depth
+						The depth of the subtree.
+		 */
+		void Dump(std::ostream& stream,
+				  std::size_t index,
+				  std::size_t depth) const;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The nodes of this profile tree.
+		 */
+		std::vector< ProfileTreeNode > m_nodes;
+	};
+
+	//-------------------------------------------------------------------------
+	// ThreadProfiler
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of thread profilers recording the call tree of the zones of a
+	 single thread.
+
+	 All nodes are preallocated from a fixed-capacity arena on construction:
+	 entering and leaving zones does not allocate. The statistics of zones
+	 which do not fit in the arena are accumulated in an overflow node.
+	 */
+	class ThreadProfiler
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The clock type of thread profilers.
+		 */
+		using ClockType = std::chrono::high_resolution_clock;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of nodes of thread profilers.
+		 */
+		static constexpr U32 s_node_capacity = 1024u;
+
+		/**
+		 The maximum depth of nested zones of thread profilers.
+		 */
+		static constexpr U32 s_max_depth = 64u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the thread profiler of the calling thread.
+
+		 @return		A reference to the thread profiler of the calling
+						thread.
+		 */
+		[[nodiscard]]
+		static ThreadProfiler& Get() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a thread profiler and registers it.
+		 */
+		ThreadProfiler();
+
+		/**
+		 Constructs a thread profiler from the given thread profiler.
+
+		 @param[in]		profiler
+						A reference to the thread profiler to copy.
+		 */
+		ThreadProfiler(const ThreadProfiler& profiler) = delete;
+
+		/**
+		 Constructs a thread profiler by moving the given thread profiler.
+
+		 @param[in]		profiler
+						A reference to the thread profiler to move.
+		 */
+		ThreadProfiler(ThreadProfiler&& profiler) = delete;
+
+		/**
+		 Destructs this thread profiler, merging its profile tree into the
+		 profile tree of retired threads.
+		 */
+		~ThreadProfiler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given thread profiler to this thread profiler.
+
+		 @param[in]		profiler
+						A reference to the thread profiler to copy.
+		 @return		A reference to the copy of the given thread profiler
+						(i.e. this thread profiler).
+		 */
+		ThreadProfiler& operator=(const ThreadProfiler& profiler) = delete;
+
+		/**
+		 Moves the given thread profiler to this thread profiler.
+
+		 @param[in]		profiler
+						A reference to the thread profiler to move.
+		 @return		A reference to the moved thread profiler (i.e. this
+						thread profiler).
+		 */
+		ThreadProfiler& operator=(ThreadProfiler&& profiler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Enters the zone with the given name.
+
+		 @param[in]		name
+						A pointer to the null-terminated name of the zone.
+						The name must outlive this thread profiler (e.g., a
+						string literal).
+		 */
+		void Enter(const char* name) noexcept;
+
+		/**
+		 Leaves the innermost zone.
+		 */
+		void Leave() noexcept;
+
+		/**
+		 Requests a reset of the statistics of this thread profiler. The
+		 reset is performed by the owning thread when it enters a zone while
+		 not being inside any zone.
+		 */
+		void RequestReset() noexcept;
+
+		/**
+		 Returns a snapshot of the profile tree of this thread profiler.
+
+		 This method may be called from any thread.
+
+		 @return		The profile tree of this thread profiler.
+		 */
+		[[nodiscard]]
+		ProfileTree GetProfileTree() const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of nodes of thread profilers.
+
+		 The name, parent and next sibling are written once before the node
+		 is published (with release semantics) via the first child of its
+		 parent. The statistics are only written by the owning thread.
+		 */
+		struct Node
+		{
+			/**
+			 A pointer to the null-terminated name of the zone of this node.
+			 */
+			const char* m_name = nullptr;
+
+			/**
+			 The index of the parent node of this node.
+			 */
+			U32 m_parent = 0u;
+
+			/**
+			 The index of the next sibling node of this node.
+			 */
+			U32 m_next_sibling = s_invalid;
+
+			/**
+			 The index of the first child node of this node.
+			 */
+			std::atomic< U32 > m_first_child = s_invalid;
+
+			/**
+			 The number of calls of the zone of this node.
+			 */
+			std::atomic< U64 > m_call_count = 0u;
+
+			/**
+			 The inclusive time (in ticks) of the zone of this node.
+			 */
+			std::atomic< U64 > m_inclusive_ticks = 0u;
+
+			/**
+			 The exclusive time (in ticks) of the zone of this node.
+			 */
+			std::atomic< U64 > m_exclusive_ticks = 0u;
+
+			/**
+			 The minimum inclusive time (in ticks) of a single call of the
+			 zone of this node.
+			 */
+			std::atomic< U64 > m_min_ticks = 0u;
+
+			/**
+			 The maximum inclusive time (in ticks) of a single call of the
+			 zone of this node.
+			 */
+			std::atomic< U64 > m_max_ticks = 0u;
+		};
+
+		/**
+		 A struct of frames (i.e. entered zones) of thread profilers.
+		 */
+		struct Frame
+		{
+			/**
+			 The timer of this frame.
+			 */
+			Timer< ClockType > m_timer;
+
+			/**
+			 The index of the node of this frame.
+			 */
+			U32 m_node = 0u;
+
+			/**
+			 The accumulated inclusive time (in ticks) of the child zones of
+			 this frame.
+			 */
+			U64 m_child_ticks = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The invalid node index of thread profilers.
+		 */
+		static constexpr U32 s_invalid = ~0u;
+
+		/**
+		 The index of the root node of thread profilers.
+		 */
+		static constexpr U32 s_root = 0u;
+
+		/**
+		 The index of the overflow node of thread profilers.
+		 */
+		static constexpr U32 s_overflow = 1u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the index of the child node of the given parent node with
+		 the given name, allocating that child node if not present.
+
+		 @param[in]		parent
+						The index of the parent node.
+		 @param[in]		name
+						A pointer to the null-terminated name of the zone.
+		 @return		The index of the child node.
+		 */
+		[[nodiscard]]
+		U32 GetChild(U32 parent, const char* name) noexcept;
+
+		/**
+		 Allocates a child node of the given parent node with the given name.
+
+		 @param[in]		parent
+						The index of the parent node.
+		 @param[in]		name
+						A pointer to the null-terminated name of the zone.
+		 @return		The index of the allocated child node, or the index
+						of the overflow node if the arena is exhausted.
+		 */
+		[[nodiscard]]
+		U32 AllocateChild(U32 parent, const char* name) noexcept;
+
+		/**
+		 Resets the statistics of all nodes of this thread profiler.
+		 */
+		void ResetStatistics() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The node arena of this thread profiler.
+		 */
+		std::unique_ptr< Node[] > m_nodes;
+
+		/**
+		 The number of allocated nodes of this thread profiler.
+		 */
+		U32 m_node_count = 0u;
+
+		/**
+		 The stack of entered zones of this thread profiler.
+		 */
+		std::unique_ptr< Frame[] > m_frames;
+
+		/**
+		 The number of entered zones of this thread profiler.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The number of entered zones exceeding the maximum depth of this
+		 thread profiler.
+		 */
+		U32 m_excess_depth = 0u;
+
+		/**
+		 Flag indicating whether a reset is requested for this thread
+		 profiler.
+		 */
+		std::atomic< bool > m_reset_requested = false;
+	};
+
+	//-------------------------------------------------------------------------
+	// ProfileZone
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of profile zones entering a zone of the thread profiler of the
+	 calling thread on construction and leaving it on destruction.
+	 */
+	class ProfileZone
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profile zone.
+
+		 @param[in]		name
+						A pointer to the null-terminated name of the zone.
+		 */
+		explicit ProfileZone(const char* name) noexcept
+			: m_profiler(ThreadProfiler::Get())
+		{
+			m_profiler.Enter(name);
+		}
+
+		/**
+		 Constructs a profile zone from the given profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to copy.
+		 */
+		ProfileZone(const ProfileZone& zone) = delete;
+
+		/**
+		 Constructs a profile zone by moving the given profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to move.
+		 */
+		ProfileZone(ProfileZone&& zone) = delete;
+
+		/**
+		 Destructs this profile zone.
+		 */
+		~ProfileZone()
+		{
+			m_profiler.Leave();
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profile zone to this profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to copy.
+		 @return		A reference to the copy of the given profile zone
+						(i.e. this profile zone).
+		 */
+		ProfileZone& operator=(const ProfileZone& zone) = delete;
+
+		/**
+		 Moves the given profile zone to this profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to move.
+		 @return		A reference to the moved profile zone (i.e. this
+						profile zone).
+		 */
+		ProfileZone& operator=(ProfileZone&& zone) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the thread profiler of this profile zone.
+		 */
+		ThreadProfiler& m_profiler;
+	};
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+
+	/**
+	 Returns a snapshot of the profile tree of each registered thread and of
+	 all retired threads.
+
+	 @return		The profile trees of all threads.
+	 */
+	[[nodiscard]]
+	std::vector< ProfileTree > CollectThreadProfileTrees();
+
+	/**
+	 Returns a snapshot of the profile trees of all threads merged into a
+	 single profile tree.
+
+	 @return		The merged profile tree of all threads.
+	 */
+	[[nodiscard]]
+	ProfileTree CollectProfileTree();
+
+	/**
+	 Resets the statistics of all threads (e.g., at the end of a frame or
+	 request).
+	 */
+	void ResetProfileTrees();
+}
+
+//-----------------------------------------------------------------------------
+// Defines
+//-----------------------------------------------------------------------------
+
+#define MAGE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MAGE_PROFILE_CONCAT(a, b) MAGE_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ Profiles the remainder of the enclosing scope as a zone with the given name.
+ */
+#define MAGE_PROFILE_ZONE(name)                                               \
+	const mage::ProfileZone                                                   \
+		MAGE_PROFILE_CONCAT(mage_profile_zone_, __LINE__)(name)
+
+/**
+ Profiles the remainder of the enclosing function as a zone.
+ */
+#define MAGE_PROFILE_FUNCTION() MAGE_PROFILE_ZONE(__func__)
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Profiling/Profiler.inl>
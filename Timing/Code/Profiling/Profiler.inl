@@ -0,0 +1,114 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	[[nodiscard]]
+	inline ThreadProfiler& ThreadProfiler::Get() noexcept
+	{
+		thread_local ThreadProfiler s_profiler;
+		return s_profiler;
+	}
+
+	inline void ThreadProfiler::Enter(const char* name) noexcept
+	{
+		if (s_max_depth == m_depth)
+		{
+			++m_excess_depth;
+			return;
+		}
+
+		if (0u == m_depth
+			&& m_reset_requested.load(std::memory_order_relaxed))
+		{
+			ResetStatistics();
+		}
+
+		const auto parent = (0u == m_depth) ? s_root
+											: m_frames[m_depth - 1u].m_node;
+
+		auto& frame = m_frames[m_depth++];
+		frame.m_node        = GetChild(parent, name);
+		frame.m_child_ticks = 0u;
+		frame.m_timer.Restart();
+	}
+
+	inline void ThreadProfiler::Leave() noexcept
+	{
+		if (0u != m_excess_depth)
+		{
+			--m_excess_depth;
+			return;
+		}
+
+		if (0u == m_depth)
+		{
+			return;
+		}
+
+		auto& frame = m_frames[--m_depth];
+		frame.m_timer.Stop();
+		const auto inclusive_ticks = static_cast< U64 >(
+			frame.m_timer.DeltaTime< ClockType::duration >().count());
+		const auto exclusive_ticks = (frame.m_child_ticks < inclusive_ticks)
+								   ? inclusive_ticks - frame.m_child_ticks : 0u;
+
+		// Only the owning thread writes the statistics: relaxed loads and
+		// stores suffice (i.e. no read-modify-write operations are needed).
+		const auto load = [](const std::atomic< U64 >& value) noexcept
+		{
+			return value.load(std::memory_order_relaxed);
+		};
+		const auto store = [](std::atomic< U64 >& value, U64 desired) noexcept
+		{
+			value.store(desired, std::memory_order_relaxed);
+		};
+
+		auto& node = m_nodes[frame.m_node];
+		const auto call_count = load(node.m_call_count);
+		store(node.m_inclusive_ticks,
+			  load(node.m_inclusive_ticks) + inclusive_ticks);
+		store(node.m_exclusive_ticks,
+			  load(node.m_exclusive_ticks) + exclusive_ticks);
+		if (0u == call_count || inclusive_ticks < load(node.m_min_ticks))
+		{
+			store(node.m_min_ticks, inclusive_ticks);
+		}
+		if (load(node.m_max_ticks) < inclusive_ticks)
+		{
+			store(node.m_max_ticks, inclusive_ticks);
+		}
+		store(node.m_call_count, call_count + 1u);
+
+		if (0u != m_depth)
+		{
+			m_frames[m_depth - 1u].m_child_ticks += inclusive_ticks;
+		}
+	}
+
+	inline void ThreadProfiler::RequestReset() noexcept
+	{
+		m_reset_requested.store(true, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]]
+	inline U32 ThreadProfiler::GetChild(U32 parent, const char* name) noexcept
+	{
+		// Zones are identified by the address of their name.
+		auto child = m_nodes[parent].m_first_child.load(
+			std::memory_order_relaxed);
+		while (s_invalid != child)
+		{
+			if (m_nodes[child].m_name == name)
+			{
+				return child;
+			}
+
+			child = m_nodes[child].m_next_sibling;
+		}
+
+		return AllocateChild(parent, name);
+	}
+}
@@ -0,0 +1,570 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// ConcurrentTimeAccumulator
+#include <Profiling/ConcurrentTimeAccumulator.hpp>
+// ConvertTimeInterval, Timer, TimeIntervalSeconds
+#include <System/Timer.hpp>
+// F64, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// array
+#include <array>
+// atomic
+#include <atomic>
+// condition_variable
+#include <condition_variable>
+// size_t
+#include <cstddef>
+// mutex
+#include <mutex>
+// thread
+#include <thread>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Rates
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of event rates (in events per second of the clock).
+	 */
+	struct Rates
+	{
+		/**
+		 The rate over the last second of these rates.
+		 */
+		F64 m_one_second = 0.0;
+
+		/**
+		 The rate over the last ten seconds of these rates.
+		 */
+		F64 m_ten_seconds = 0.0;
+
+		/**
+		 The rate over the last minute of these rates.
+		 */
+		F64 m_one_minute = 0.0;
+
+		/**
+		 The exponentially weighted moving average rate of these rates.
+		 */
+		F64 m_ewma = 0.0;
+
+		/**
+		 The total number of events of these rates.
+		 */
+		U64 m_count = 0u;
+	};
+
+	//-------------------------------------------------------------------------
+	// RateMeter
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of rate meters measuring the number of events per second over
+	 sliding windows of one second, ten seconds and one minute, and as an
+	 exponentially weighted moving average (EWMA).
+
+	 Each thread counts its events on its own cache-line-sized shard (i.e.
+	 threads are assigned to shards round-robin on first use), so marking an
+	 event is a single relaxed atomic increment without reading the clock.
+	 A background ticker of each rate meter sums the shards at every bucket
+	 boundary (i.e. every 100 ms of the clock) and records the cumulative
+	 count into a ring of one minute of buckets, so the buckets do not
+	 depend on how often the rates are read. The windowed rates interpolate
+	 within the oldest bucket of their window. Reading costs
+	 O(shards + buckets) and serializes readers and the ticker only.
+
+	 Events of buckets the ticker missed (e.g., while the process was
+	 suspended) are spread uniformly over those buckets. Windows longer
+	 than the lifetime of the rate meter cover its lifetime instead, and
+	 all rates are zero during the first bucket.
+
+	 @tparam		ClockT
+					The clock type (e.g., a clock of @c SystemTime.hpp or
+					@c std::chrono). The rates are per second of this clock.
+	 @tparam		ShardCountV
+					The number of shards.
+	 */
+	template< typename ClockT, std::size_t ShardCountV = 64u >
+	class RateMeter
+	{
+
+		static_assert(0u < ShardCountV);
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time stamp type of rate meters.
+		 */
+		using TimeStamp = typename ClockT::time_point;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a rate meter and starts its ticker.
+
+		 @param[in]		ewma_time_constant
+						The time constant of the exponentially weighted
+						moving average (i.e. the age at which the weight of
+						a rate decayed to 1/e).
+		 */
+		explicit RateMeter(TimeIntervalSeconds ewma_time_constant
+						   = TimeIntervalSeconds(10.0));
+
+		/**
+		 Constructs a rate meter from the given rate meter.
+
+		 @param[in]		meter
+						A reference to the rate meter to copy.
+		 */
+		RateMeter(const RateMeter& meter) = delete;
+
+		/**
+		 Constructs a rate meter by moving the given rate meter.
+
+		 @param[in]		meter
+						A reference to the rate meter to move.
+		 */
+		RateMeter(RateMeter&& meter) = delete;
+
+		/**
+		 Destructs this rate meter and stops its ticker.
+		 */
+		~RateMeter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given rate meter to this rate meter.
+
+		 @param[in]		meter
+						A reference to the rate meter to copy.
+		 @return		A reference to the copy of the given rate meter (i.e.
+						this rate meter).
+		 */
+		RateMeter& operator=(const RateMeter& meter) = delete;
+
+		/**
+		 Moves the given rate meter to this rate meter.
+
+		 @param[in]		meter
+						A reference to the rate meter to move.
+		 @return		A reference to the moved rate meter (i.e. this rate
+						meter).
+		 */
+		RateMeter& operator=(RateMeter&& meter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Marks the given number of events on this rate meter.
+
+		 @param[in]		count
+						The number of events.
+		 */
+		void Mark(U64 count = 1u) noexcept;
+
+		/**
+		 Resets this rate meter and restarts its windows at the current time
+		 of the clock.
+
+		 @note			Events marked concurrently may or may not be
+						discarded.
+		 */
+		void Reset() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the rates of this rate meter at the current time of the
+		 clock.
+
+		 @return		The rates of this rate meter.
+		 */
+		[[nodiscard]]
+		Rates GetRates() noexcept;
+
+		/**
+		 Returns the rates of this rate meter at the given time.
+
+		 @param[in]		now
+						The current time (not before the time of any previous
+						call).
+		 @return		The rates of this rate meter.
+		 */
+		[[nodiscard]]
+		Rates GetRates(TimeStamp now) noexcept;
+
+		/**
+		 Returns the total number of events of this rate meter.
+
+		 @return		The total number of events of this rate meter.
+		 */
+		[[nodiscard]]
+		U64 GetCount() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shards of rate meters.
+		 */
+		struct alignas(64) Shard
+		{
+			/**
+			 The number of events of this shard.
+			 */
+			std::atomic< U64 > m_count = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The width (in seconds) of the buckets of rate meters.
+		 */
+		static constexpr F64 s_bucket_width = 0.1;
+
+		/**
+		 The number of buckets of rate meters (i.e. one minute of buckets
+		 plus the partial oldest and current bucket).
+		 */
+		static constexpr std::size_t s_bucket_count = 602u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shard index of the calling thread.
+
+		 @return		The shard index of the calling thread.
+		 */
+		[[nodiscard]]
+		static std::size_t GetShardIndex() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the elapsed bucket boundaries and updates the exponentially
+		 weighted moving average of this rate meter up to the given time.
+
+		 @param[in]		now
+						The current time.
+		 @note			The caller must hold the mutex of this rate meter.
+		 */
+		void Advance(TimeStamp now) noexcept;
+
+		/**
+		 Advances this rate meter at every bucket boundary until stopped.
+		 */
+		void Run();
+
+		/**
+		 Returns the cumulative number of events of this rate meter at the
+		 given time, interpolated between the bucket boundaries.
+
+		 @param[in]		time
+						The time (in seconds since the origin, within the
+						last minute of buckets).
+		 @return		The cumulative number of events at the given time.
+		 */
+		[[nodiscard]]
+		F64 GetCountAt(F64 time) const noexcept;
+
+		/**
+		 Returns the rate over the given window of this rate meter.
+
+		 @param[in]		window
+						The window (in seconds).
+		 @return		The rate over the given window.
+		 */
+		[[nodiscard]]
+		F64 GetRate(F64 window) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shards of this rate meter.
+		 */
+		std::array< Shard, ShardCountV > m_shards = {};
+
+		/**
+		 The mutex serializing the readers of this rate meter.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The origin (i.e. the time of the first bucket boundary) of this
+		 rate meter.
+		 */
+		TimeStamp m_origin;
+
+		/**
+		 The cumulative numbers of events at the bucket boundaries (indexed
+		 modulo the number of buckets) of this rate meter.
+		 */
+		std::array< U64, s_bucket_count > m_boundary_counts;
+
+		/**
+		 The index of the last recorded bucket boundary of this rate meter.
+		 */
+		U64 m_boundary;
+
+		/**
+		 The time (in seconds since the origin) of the last read of this
+		 rate meter.
+		 */
+		F64 m_last_time;
+
+		/**
+		 The cumulative number of events at the last read of this rate
+		 meter.
+		 */
+		U64 m_last_count;
+
+		/**
+		 The time constant (in seconds) of the exponentially weighted moving
+		 average of this rate meter.
+		 */
+		F64 m_ewma_time_constant;
+
+		/**
+		 The exponentially weighted moving average rate of this rate meter.
+		 */
+		F64 m_ewma;
+
+		/**
+		 Flag indicating whether the exponentially weighted moving average
+		 of this rate meter is initialized.
+		 */
+		bool m_has_ewma;
+
+		/**
+		 The mutex guarding the stop flag of this rate meter.
+		 */
+		std::mutex m_stop_mutex;
+
+		/**
+		 The condition variable signaling the stop flag of this rate meter.
+		 */
+		std::condition_variable m_stop_condition;
+
+		/**
+		 Flag indicating whether the ticker of this rate meter must stop.
+		 */
+		bool m_stop;
+
+		/**
+		 The background ticker of this rate meter.
+		 */
+		std::thread m_ticker;
+	};
+
+	//-------------------------------------------------------------------------
+	// StageMeter
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of statistics of stage meters.
+	 */
+	struct StageStatistics
+	{
+		/**
+		 The operation rates (i.e. operations per second) of these
+		 statistics.
+		 */
+		Rates m_rates;
+
+		/**
+		 The mean time per operation of these statistics.
+		 */
+		TimeIntervalSeconds m_mean_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The total time of all operations of these statistics.
+		 */
+		TimeIntervalSeconds m_total_time = TimeIntervalSeconds::zero();
+	};
+
+	/**
+	 A class of stage meters measuring both the throughput (i.e. operations
+	 per second) and the latency (i.e. time per operation) of a pipeline
+	 stage from a single instrumentation point.
+
+	 The rates are windowed (see @c RateMeter) whereas the mean time per
+	 operation covers the lifetime of the stage meter.
+
+	 @tparam		ClockT
+					The clock type.
+	 @tparam		ShardCountV
+					The number of shards.
+	 */
+	template< typename ClockT, std::size_t ShardCountV = 64u >
+	class StageMeter
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time interval type of stage meters.
+		 */
+		using TimeInterval = typename ClockT::duration;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a stage meter.
+
+		 @param[in]		ewma_time_constant
+						The time constant of the exponentially weighted
+						moving average rate.
+		 */
+		explicit StageMeter(TimeIntervalSeconds ewma_time_constant
+							= TimeIntervalSeconds(10.0));
+
+		/**
+		 Constructs a stage meter from the given stage meter.
+
+		 @param[in]		meter
+						A reference to the stage meter to copy.
+		 */
+		StageMeter(const StageMeter& meter) = delete;
+
+		/**
+		 Constructs a stage meter by moving the given stage meter.
+
+		 @param[in]		meter
+						A reference to the stage meter to move.
+		 */
+		StageMeter(StageMeter&& meter) = delete;
+
+		/**
+		 Destructs this stage meter.
+		 */
+		~StageMeter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given stage meter to this stage meter.
+
+		 @param[in]		meter
+						A reference to the stage meter to copy.
+		 @return		A reference to the copy of the given stage meter
+						(i.e. this stage meter).
+		 */
+		StageMeter& operator=(const StageMeter& meter) = delete;
+
+		/**
+		 Moves the given stage meter to this stage meter.
+
+		 @param[in]		meter
+						A reference to the stage meter to move.
+		 @return		A reference to the moved stage meter (i.e. this
+						stage meter).
+		 */
+		StageMeter& operator=(StageMeter&& meter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Records an operation with the given duration on this stage meter.
+
+		 @param[in]		time_interval
+						The duration of the operation.
+		 */
+		void Record(TimeInterval time_interval) noexcept;
+
+		/**
+		 Records an operation with the delta time of the given timer on this
+		 stage meter.
+
+		 @param[in,out]	timer
+						A reference to the timer.
+		 */
+		void Record(Timer< ClockT >& timer) noexcept;
+
+		/**
+		 Resets this stage meter.
+		 */
+		void Reset() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the statistics of this stage meter at the current time of
+		 the clock.
+
+		 @return		The statistics of this stage meter.
+		 */
+		[[nodiscard]]
+		StageStatistics GetStatistics() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The rate meter of this stage meter.
+		 */
+		RateMeter< ClockT, ShardCountV > m_rate_meter;
+
+		/**
+		 The time accumulator of this stage meter.
+		 */
+		ConcurrentTimeAccumulator< ClockT, ShardCountV > m_time_accumulator;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Profiling/RateMeter.inl>
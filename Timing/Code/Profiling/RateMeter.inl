@@ -0,0 +1,316 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// clamp, max, min
+#include <algorithm>
+// duration
+#include <chrono>
+// exp, floor, round
+#include <cmath>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// RateMeter
+	//-------------------------------------------------------------------------
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline RateMeter< ClockT, ShardCountV >
+		::RateMeter(TimeIntervalSeconds ewma_time_constant)
+		: m_mutex(),
+		m_origin(ClockT::now()),
+		m_boundary_counts{},
+		m_boundary(0u),
+		m_last_time(0.0),
+		m_last_count(0u),
+		m_ewma_time_constant(ewma_time_constant.count()),
+		m_ewma(0.0),
+		m_has_ewma(false),
+		m_stop_mutex(),
+		m_stop_condition(),
+		m_stop(false),
+		m_ticker()
+	{
+		m_ticker = std::thread([this]() { Run(); });
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline RateMeter< ClockT, ShardCountV >::~RateMeter()
+	{
+		{
+			const std::scoped_lock lock(m_stop_mutex);
+			m_stop = true;
+		}
+		m_stop_condition.notify_all();
+		m_ticker.join();
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void RateMeter< ClockT, ShardCountV >::Mark(U64 count) noexcept
+	{
+		m_shards[GetShardIndex()].m_count.fetch_add(
+			count, std::memory_order_relaxed);
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	void RateMeter< ClockT, ShardCountV >::Reset() noexcept
+	{
+		const std::scoped_lock lock(m_mutex);
+
+		for (auto& shard : m_shards)
+		{
+			shard.m_count.store(0u, std::memory_order_relaxed);
+		}
+
+		m_origin = ClockT::now();
+		m_boundary_counts.fill(0u);
+		m_boundary   = 0u;
+		m_last_time  = 0.0;
+		m_last_count = 0u;
+		m_ewma       = 0.0;
+		m_has_ewma   = false;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline Rates RateMeter< ClockT, ShardCountV >::GetRates() noexcept
+	{
+		return GetRates(ClockT::now());
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	Rates RateMeter< ClockT, ShardCountV >::GetRates(TimeStamp now) noexcept
+	{
+		const std::scoped_lock lock(m_mutex);
+
+		Advance(now);
+
+		Rates rates;
+		rates.m_one_second  = GetRate(1.0);
+		rates.m_ten_seconds = GetRate(10.0);
+		rates.m_one_minute  = GetRate(60.0);
+		rates.m_ewma        = m_ewma;
+		rates.m_count       = m_last_count;
+		return rates;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline U64 RateMeter< ClockT, ShardCountV >::GetCount() const noexcept
+	{
+		U64 count = 0u;
+		for (const auto& shard : m_shards)
+		{
+			count += shard.m_count.load(std::memory_order_relaxed);
+		}
+
+		return count;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	inline std::size_t RateMeter< ClockT, ShardCountV >
+		::GetShardIndex() noexcept
+	{
+		static std::atomic< std::size_t > s_thread_count = 0u;
+		thread_local const auto s_index
+			= s_thread_count.fetch_add(1u, std::memory_order_relaxed)
+			% ShardCountV;
+		return s_index;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	void RateMeter< ClockT, ShardCountV >::Advance(TimeStamp now) noexcept
+	{
+		// The count never decreases between advances (e.g., due to a
+		// concurrent reset of a shard).
+		const auto count = std::max(GetCount(), m_last_count);
+		const auto time  = std::max(
+			ConvertTimeInterval< ClockT, TimeIntervalSeconds >(
+				now - m_origin).count(),
+			m_last_time);
+		const auto delta_count = static_cast< F64 >(count - m_last_count);
+		const auto delta_time  = time - m_last_time;
+
+		// Records the elapsed bucket boundaries (at most one ring of them),
+		// spreading the events since the last advance uniformly (i.e. over
+		// a single bucket unless the ticker missed some).
+		const auto boundary = static_cast< U64 >(
+			std::floor(time / s_bucket_width));
+		if (m_boundary < boundary)
+		{
+			const auto first = std::max(m_boundary + 1u,
+				boundary + 1u - std::min< U64 >(boundary + 1u,
+												s_bucket_count));
+			for (auto i = first; i <= boundary; ++i)
+			{
+				const auto fraction = (0.0 < delta_time) ? std::clamp(
+					(static_cast< F64 >(i) * s_bucket_width - m_last_time)
+					/ delta_time, 0.0, 1.0) : 1.0;
+				m_boundary_counts[i % s_bucket_count] = m_last_count
+					+ static_cast< U64 >(std::round(fraction * delta_count));
+			}
+
+			m_boundary = boundary;
+		}
+
+		// Updates the exponentially weighted moving average with the mean
+		// rate since the last advance, weighted by the elapsed time. It
+		// starts at the mean rate of the first bucket.
+		if (m_has_ewma)
+		{
+			if (0.0 < delta_time)
+			{
+				const auto rate  = delta_count / delta_time;
+				const auto decay = (0.0 < m_ewma_time_constant)
+					? std::exp(-delta_time / m_ewma_time_constant) : 0.0;
+				m_ewma = rate + decay * (m_ewma - rate);
+			}
+		}
+		else if (s_bucket_width <= time)
+		{
+			m_ewma     = static_cast< F64 >(count) / time;
+			m_has_ewma = true;
+		}
+
+		m_last_time  = time;
+		m_last_count = count;
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	void RateMeter< ClockT, ShardCountV >::Run()
+	{
+		std::unique_lock stop_lock(m_stop_mutex);
+		for (;;)
+		{
+			F64 time = 0.0;
+			{
+				const std::scoped_lock lock(m_mutex);
+				Advance(ClockT::now());
+				time = m_last_time;
+			}
+
+			// Wakes up just after the next bucket boundary. Waking up early
+			// only costs an extra advance.
+			const auto next_time = (std::floor(time / s_bucket_width) + 1.0)
+								 * s_bucket_width;
+			const auto timeout = std::chrono::duration< F64 >(
+				next_time - time);
+			if (m_stop_condition.wait_for(stop_lock, timeout,
+										  [this]() { return m_stop; }))
+			{
+				return;
+			}
+		}
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	F64 RateMeter< ClockT, ShardCountV >::GetCountAt(F64 time) const noexcept
+	{
+		// The bucket containing the given time, clamped to the ring.
+		const auto oldest = m_boundary + 1u
+						  - std::min< U64 >(m_boundary + 1u, s_bucket_count);
+		const auto boundary = std::clamp(
+			static_cast< U64 >(std::floor(std::max(time, 0.0)
+										  / s_bucket_width)),
+			oldest, m_boundary);
+
+		const auto lower_time  = static_cast< F64 >(boundary)
+							   * s_bucket_width;
+		const auto lower_count = static_cast< F64 >(
+			m_boundary_counts[boundary % s_bucket_count]);
+
+		const auto upper_time  = (boundary < m_boundary)
+			? lower_time + s_bucket_width : m_last_time;
+		const auto upper_count = static_cast< F64 >((boundary < m_boundary)
+			? m_boundary_counts[(boundary + 1u) % s_bucket_count]
+			: m_last_count);
+
+		if (upper_time <= lower_time)
+		{
+			return lower_count;
+		}
+
+		const auto fraction = std::clamp(
+			(time - lower_time) / (upper_time - lower_time), 0.0, 1.0);
+		return lower_count + fraction * (upper_count - lower_count);
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	F64 RateMeter< ClockT, ShardCountV >::GetRate(F64 window) const noexcept
+	{
+		if (m_last_time < s_bucket_width)
+		{
+			return 0.0;
+		}
+
+		const auto span = std::min(window, m_last_time);
+
+		const auto count = static_cast< F64 >(m_last_count)
+						 - GetCountAt(m_last_time - span);
+		return count / span;
+	}
+
+	//-------------------------------------------------------------------------
+	// StageMeter
+	//-------------------------------------------------------------------------
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline StageMeter< ClockT, ShardCountV >
+		::StageMeter(TimeIntervalSeconds ewma_time_constant)
+		: m_rate_meter(ewma_time_constant),
+		m_time_accumulator()
+	{}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void StageMeter< ClockT, ShardCountV >
+		::Record(TimeInterval time_interval) noexcept
+	{
+		m_time_accumulator.Add(time_interval);
+		m_rate_meter.Mark();
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void StageMeter< ClockT, ShardCountV >
+		::Record(Timer< ClockT >& timer) noexcept
+	{
+		Record(timer.template DeltaTime< TimeInterval >());
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	inline void StageMeter< ClockT, ShardCountV >::Reset() noexcept
+	{
+		m_time_accumulator.Reset();
+		m_rate_meter.Reset();
+	}
+
+	template< typename ClockT, std::size_t ShardCountV >
+	[[nodiscard]]
+	StageStatistics StageMeter< ClockT, ShardCountV >
+		::GetStatistics() noexcept
+	{
+		const auto time_statistics = m_time_accumulator.GetStatistics();
+
+		StageStatistics statistics;
+		statistics.m_rates      = m_rate_meter.GetRates();
+		statistics.m_total_time
+			= ConvertTimeInterval< ClockT, TimeIntervalSeconds >(
+				time_statistics.m_total);
+		if (0u != time_statistics.m_count)
+		{
+			statistics.m_mean_time = statistics.m_total_time
+				/ static_cast< F64 >(time_statistics.m_count);
+		}
+
+		return statistics;
+	}
+}
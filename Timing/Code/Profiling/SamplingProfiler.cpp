@@ -0,0 +1,686 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/SamplingProfiler.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max, min, sort
+#include <algorithm>
+// atomic
+#include <atomic>
+// uintptr_t
+#include <cstdint>
+// free
+#include <cstdlib>
+// setprecision, setw
+#include <iomanip>
+// unique_ptr
+#include <memory>
+// mutex
+#include <mutex>
+// ostream
+#include <ostream>
+// ostringstream
+#include <sstream>
+// string_view
+#include <string_view>
+// unordered_map
+#include <unordered_map>
+// unordered_set
+#include <unordered_set>
+// move
+#include <utility>
+
+#ifndef _WIN32
+
+// __cxa_demangle
+#include <cxxabi.h>
+// dladdr, Dl_info
+#include <dlfcn.h>
+// EFAULT, errno
+#include <errno.h>
+// sigaction, sigevent, SIGPROF
+#include <signal.h>
+// SYS_rt_sigprocmask
+#include <sys/syscall.h>
+// clock_gettime, timer_create, timer_delete, timer_settime
+#include <time.h>
+// ucontext_t
+#include <ucontext.h>
+// syscall
+#include <unistd.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The maximum number of frames of a sample.
+		 */
+		constexpr std::size_t g_max_frame_count = 64u;
+
+		/**
+		 A struct of samples (i.e. raw call stacks).
+		 */
+		struct Sample
+		{
+			/**
+			 The return addresses (from the innermost frame) of this sample.
+			 */
+			void* m_frames[g_max_frame_count];
+
+			/**
+			 The number of frames of this sample.
+			 */
+			int m_frame_count;
+
+			/**
+			 The number of sampling periods (i.e. one plus the timer
+			 overruns) represented by this sample.
+			 */
+			U64 m_weight;
+		};
+
+		/**
+		 The mutex serializing starting and stopping the sampling profiler.
+		 */
+		std::mutex g_profiler_mutex;
+
+		/**
+		 The preallocated samples of the sampling profiler.
+		 */
+		std::unique_ptr< Sample[] > g_samples;
+
+		/**
+		 The capacity of the preallocated samples of the sampling profiler.
+		 */
+		std::size_t g_capacity = 0u;
+
+		/**
+		 The sampling frequency of the sampling profiler.
+		 */
+		U32 g_frequency = 0u;
+
+		/**
+		 The number of claimed samples (which may exceed the capacity) of the
+		 sampling profiler.
+		 */
+		std::atomic< std::size_t > g_claimed_count = 0u;
+
+		/**
+		 The number of elapsed sampling periods (including those of dropped
+		 samples) of the sampling profiler.
+		 */
+		std::atomic< U64 > g_period_count = 0u;
+
+		/**
+		 The wall clock time (in nanoseconds) spent in the signal handler of
+		 the sampling profiler.
+		 */
+		std::atomic< U64 > g_handler_time = 0u;
+
+		/**
+		 The number of signal handlers in flight of the sampling profiler.
+		 */
+		std::atomic< U32 > g_active_handler_count = 0u;
+
+		/**
+		 Flag indicating whether the sampling profiler is running.
+		 */
+		std::atomic< bool > g_running = false;
+
+#ifndef _WIN32
+
+		/**
+		 The maximum distance (in bytes) between the interrupted stack
+		 pointer and a frame pointer of a captured stack.
+		 */
+		constexpr std::uintptr_t g_max_stack_size
+			= std::uintptr_t(1u) << 26u;
+
+		/**
+		 The (minimum) page size used for validating frame pointers.
+		 */
+		constexpr std::uintptr_t g_page_size = 4096u;
+
+		/**
+		 The POSIX timer of the sampling profiler.
+		 */
+		timer_t g_timer;
+
+		/**
+		 Flag indicating whether the signal handler of the sampling profiler
+		 is installed. The signal handler stays installed once started, as
+		 a @c SIGPROF still pending after stopping would otherwise terminate
+		 the process (i.e. the default action).
+		 */
+		bool g_handler_installed = false;
+
+		/**
+		 Returns the current monotonic timestamp (in nanoseconds). This is
+		 async-signal-safe.
+
+		 @return		The current monotonic timestamp.
+		 */
+		[[nodiscard]]
+		U64 MonotonicTimestamp() noexcept
+		{
+			timespec time = {};
+			::clock_gettime(CLOCK_MONOTONIC, &time);
+			return static_cast< U64 >(time.tv_sec) * 1'000'000'000u
+				 + static_cast< U64 >(time.tv_nsec);
+		}
+
+		/**
+		 Checks whether the given address is readable by the calling
+		 process. This is async-signal-safe.
+
+		 @param[in]		address
+						The address.
+		 @return		@c true if the given address is readable. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsReadable(std::uintptr_t address) noexcept
+		{
+			// The kernel copies the new signal set before validating the
+			// (invalid) operation, so only an unreadable address results in
+			// EFAULT. The size is the one of the kernel signal set.
+			return !(-1 == ::syscall(SYS_rt_sigprocmask, ~0,
+									 reinterpret_cast< void* >(address),
+									 nullptr, sizeof(U64))
+					 && EFAULT == errno);
+		}
+
+		/**
+		 Captures the call stack of the given interrupted context by
+		 walking its frame pointers. This is async-signal-safe (i.e. unlike
+		 @c backtrace, it neither locks nor allocates).
+
+		 The walk stops at the first frame pointer that does not lie above
+		 the previous one within @c g_max_stack_size of the interrupted
+		 stack pointer, that is misaligned, or whose frame record is not
+		 readable.
+
+		 @param[in]		context
+						A reference to the interrupted context.
+		 @param[out]	frames
+						A pointer to the return addresses (from the
+						interrupted instruction).
+		 @param[in]		max_frame_count
+						The maximum number of frames.
+		 @return		The number of captured frames.
+		 */
+		[[nodiscard]]
+		int CaptureStack(const ucontext_t& context,
+						 void** frames,
+						 std::size_t max_frame_count) noexcept
+		{
+#if defined(__x86_64__)
+			const auto pc = context.uc_mcontext.gregs[REG_RIP];
+			auto fp = static_cast< std::uintptr_t >(
+				context.uc_mcontext.gregs[REG_RBP]);
+			const auto sp = static_cast< std::uintptr_t >(
+				context.uc_mcontext.gregs[REG_RSP]);
+#elif defined(__aarch64__)
+			const auto pc = context.uc_mcontext.pc;
+			auto fp = static_cast< std::uintptr_t >(
+				context.uc_mcontext.regs[29]);
+			const auto sp = static_cast< std::uintptr_t >(
+				context.uc_mcontext.sp);
+#else
+			static_cast< void >(context);
+			static_cast< void >(frames);
+			static_cast< void >(max_frame_count);
+			return 0;
+#endif
+
+#if defined(__x86_64__) || defined(__aarch64__)
+			if (0u == max_frame_count)
+			{
+				return 0;
+			}
+
+			frames[0] = reinterpret_cast< void* >(pc);
+			std::size_t frame_count = 1u;
+
+			// A frame record consists of the caller's frame pointer followed
+			// by the return address.
+			auto lower = sp;
+			auto readable_page = ~std::uintptr_t(0u);
+			while (frame_count < max_frame_count)
+			{
+				if (fp < lower || g_max_stack_size < fp - sp
+					|| 0u != fp % alignof(void*))
+				{
+					break;
+				}
+
+				const auto first_page = fp & ~(g_page_size - 1u);
+				const auto last_page
+					= (fp + 2u * sizeof(void*) - 1u) & ~(g_page_size - 1u);
+				if ((first_page != readable_page && !IsReadable(fp))
+					|| (last_page != first_page && !IsReadable(last_page)))
+				{
+					break;
+				}
+				readable_page = last_page;
+
+				const auto* const record = reinterpret_cast< void** >(fp);
+				if (nullptr == record[1])
+				{
+					break;
+				}
+
+				frames[frame_count++] = record[1];
+				lower = fp + 2u * sizeof(void*);
+				fp    = reinterpret_cast< std::uintptr_t >(record[0]);
+			}
+
+			return static_cast< int >(frame_count);
+#endif
+		}
+
+		/**
+		 Handles a @c SIGPROF signal by capturing the call stack of the
+		 interrupted thread into the next preallocated sample.
+
+		 @param[in]		signal
+						The signal number.
+		 @param[in]		info
+						A pointer to the signal information.
+		 @param[in]		context
+						A pointer to the user context.
+		 */
+		void HandleProfilingSignal([[maybe_unused]] int signal,
+								   siginfo_t* info,
+								   void* context) noexcept
+		{
+			g_active_handler_count.fetch_add(1u);
+			const auto saved_errno = errno;
+			const auto start = MonotonicTimestamp();
+
+			if (g_running.load())
+			{
+				// The kernel checks CPU time timers on scheduler ticks, so
+				// periods shorter than a tick are coalesced into overruns.
+				const auto weight = 1u + static_cast< U64 >(
+					std::max(info->si_overrun, 0));
+				g_period_count.fetch_add(weight, std::memory_order_relaxed);
+
+				const auto index
+					= g_claimed_count.fetch_add(1u, std::memory_order_relaxed);
+				if (index < g_capacity)
+				{
+					auto& sample = g_samples[index];
+					sample.m_weight = weight;
+					sample.m_frame_count = CaptureStack(
+						*static_cast< const ucontext_t* >(context),
+						sample.m_frames, g_max_frame_count);
+				}
+			}
+
+			g_handler_time.fetch_add(MonotonicTimestamp() - start,
+									 std::memory_order_relaxed);
+			errno = saved_errno;
+			g_active_handler_count.fetch_sub(1u);
+		}
+
+		/**
+		 Returns the symbol name of the given code address.
+
+		 @param[in]		address
+						The code address.
+		 @return		The demangled symbol name, the bracketed module name
+						if the symbol is unknown, or the address if the
+						module is unknown.
+		 */
+		[[nodiscard]]
+		std::string Symbolize(const void* address)
+		{
+			std::ostringstream name;
+
+			Dl_info info = {};
+			if (0 == ::dladdr(address, &info))
+			{
+				name << address;
+				return name.str();
+			}
+
+			if (nullptr != info.dli_sname)
+			{
+				int status = 0;
+				const std::unique_ptr< char, decltype(&std::free) > demangled(
+					abi::__cxa_demangle(info.dli_sname, nullptr, nullptr,
+										&status),
+					&std::free);
+				return (0 == status && nullptr != demangled)
+					 ? std::string(demangled.get())
+					 : std::string(info.dli_sname);
+			}
+
+			// Without a symbol, samples are aggregated per module.
+			std::string_view module = (nullptr != info.dli_fname)
+									? info.dli_fname : "?";
+			if (const auto slash = module.rfind('/');
+				std::string_view::npos != slash)
+			{
+				module.remove_prefix(slash + 1u);
+			}
+
+			name << '[' << module << ']';
+			return name.str();
+		}
+
+#endif
+	}
+
+	[[nodiscard]]
+	F64 SamplingProfile::GetOverhead() const noexcept
+	{
+		if (0u == m_frequency || 0u == m_period_count)
+		{
+			return 0.0;
+		}
+
+		const auto cpu_time = static_cast< F64 >(m_period_count)
+							/ static_cast< F64 >(m_frequency);
+		return m_handler_time.count() / cpu_time;
+	}
+
+	//-------------------------------------------------------------------------
+	// Sampling Profiler
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	bool StartSamplingProfiler(U32 frequency, std::size_t capacity)
+	{
+#ifdef _WIN32
+		static_cast< void >(frequency);
+		static_cast< void >(capacity);
+		return false;
+#else
+		const std::scoped_lock lock(g_profiler_mutex);
+
+		if (g_running.load(std::memory_order_relaxed)
+			|| 0u == frequency || 0u == capacity)
+		{
+			return false;
+		}
+
+		g_samples     = std::make_unique< Sample[] >(capacity);
+		g_capacity    = capacity;
+		g_frequency   = frequency;
+		g_claimed_count.store(0u, std::memory_order_relaxed);
+		g_period_count.store(0u, std::memory_order_relaxed);
+		g_handler_time.store(0u, std::memory_order_relaxed);
+
+		if (!g_handler_installed)
+		{
+			struct sigaction action = {};
+			action.sa_sigaction = &HandleProfilingSignal;
+			action.sa_flags     = SA_SIGINFO | SA_RESTART;
+			::sigemptyset(&action.sa_mask);
+			if (0 != ::sigaction(SIGPROF, &action, nullptr))
+			{
+				return false;
+			}
+
+			g_handler_installed = true;
+		}
+
+		sigevent event = {};
+		event.sigev_notify = SIGEV_SIGNAL;
+		event.sigev_signo  = SIGPROF;
+		if (0 != ::timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &g_timer))
+		{
+			return false;
+		}
+
+		const auto period = 1'000'000'000u / frequency;
+		itimerspec interval = {};
+		interval.it_interval.tv_sec  = period / 1'000'000'000u;
+		interval.it_interval.tv_nsec = period % 1'000'000'000u;
+		interval.it_value            = interval.it_interval;
+
+		g_running.store(true);
+		if (0 != ::timer_settime(g_timer, 0, &interval, nullptr))
+		{
+			g_running.store(false);
+			::timer_delete(g_timer);
+			return false;
+		}
+
+		return true;
+#endif
+	}
+
+	void StopSamplingProfiler()
+	{
+#ifndef _WIN32
+		const std::scoped_lock lock(g_profiler_mutex);
+
+		if (!g_running.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		::timer_delete(g_timer);
+		g_running.store(false);
+
+		// Waits for signal handlers in flight on other threads.
+		while (0u != g_active_handler_count.load())
+		{}
+#endif
+	}
+
+	[[nodiscard]]
+	bool IsSamplingProfilerRunning() noexcept
+	{
+		return g_running.load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]]
+	SamplingProfile GetSamplingProfile()
+	{
+		SamplingProfile profile;
+
+#ifndef _WIN32
+		const std::scoped_lock lock(g_profiler_mutex);
+
+		if (g_running.load(std::memory_order_relaxed))
+		{
+			return profile;
+		}
+
+		const auto claimed_count
+			= g_claimed_count.load(std::memory_order_relaxed);
+		const auto sample_count = std::min(claimed_count, g_capacity);
+
+		profile.m_sample_count  = sample_count;
+		profile.m_dropped_count = claimed_count - sample_count;
+		profile.m_period_count
+			= g_period_count.load(std::memory_order_relaxed);
+		profile.m_frequency     = g_frequency;
+		profile.m_handler_time  = TimeIntervalSeconds(
+			1e-9 * static_cast< F64 >(
+				g_handler_time.load(std::memory_order_relaxed)));
+
+		std::unordered_map< const void*, std::string > symbols;
+		std::unordered_map< std::string, std::size_t > stack_indices;
+
+		for (std::size_t i = 0u; i < sample_count; ++i)
+		{
+			const auto& sample = g_samples[i];
+
+			SampledStack stack;
+			for (auto j = sample.m_frame_count - 1; 0 <= j; --j)
+			{
+				// Return addresses point past the call instruction, except
+				// for the interrupted instruction itself.
+				const auto* address
+					= static_cast< const char* >(sample.m_frames[j])
+					- ((0 == j) ? 0 : 1);
+
+				auto it = symbols.find(address);
+				if (symbols.cend() == it)
+				{
+					it = symbols.emplace(address, Symbolize(address)).first;
+				}
+				stack.m_frames.push_back(it->second);
+			}
+
+			std::string key;
+			for (const auto& frame : stack.m_frames)
+			{
+				key += frame;
+				key += '\0';
+			}
+
+			const auto [it, inserted]
+				= stack_indices.try_emplace(std::move(key),
+											profile.m_stacks.size());
+			if (inserted)
+			{
+				profile.m_stacks.push_back(std::move(stack));
+			}
+			profile.m_stacks[it->second].m_count += sample.m_weight;
+		}
+
+		std::sort(profile.m_stacks.begin(), profile.m_stacks.end(),
+				  [](const SampledStack& lhs, const SampledStack& rhs)
+				  {
+					  return lhs.m_count > rhs.m_count;
+				  });
+#endif
+
+		return profile;
+	}
+
+	//-------------------------------------------------------------------------
+	// Sampling Profile Reporting
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	std::vector< SampledSymbol >
+		GetSampledSymbols(const SamplingProfile& profile)
+	{
+		std::vector< SampledSymbol > symbols;
+		std::unordered_map< std::string_view, std::size_t > symbol_indices;
+
+		const auto get_symbol = [&](const std::string& name) -> SampledSymbol&
+		{
+			const auto [it, inserted]
+				= symbol_indices.try_emplace(name, symbols.size());
+			if (inserted)
+			{
+				symbols.push_back({ name, 0u, 0u });
+			}
+			return symbols[it->second];
+		};
+
+		for (const auto& stack : profile.m_stacks)
+		{
+			if (stack.m_frames.empty())
+			{
+				continue;
+			}
+
+			get_symbol(stack.m_frames.back()).m_self_count += stack.m_count;
+
+			// Counts recursive frames once per stack.
+			std::unordered_set< std::string_view > seen;
+			for (const auto& frame : stack.m_frames)
+			{
+				if (seen.insert(frame).second)
+				{
+					get_symbol(frame).m_total_count += stack.m_count;
+				}
+			}
+		}
+
+		std::sort(symbols.begin(), symbols.end(),
+				  [](const SampledSymbol& lhs, const SampledSymbol& rhs)
+				  {
+					  return (lhs.m_self_count != rhs.m_self_count)
+						   ? lhs.m_self_count > rhs.m_self_count
+						   : lhs.m_total_count > rhs.m_total_count;
+				  });
+
+		return symbols;
+	}
+
+	void WriteFoldedStacks(std::ostream& stream,
+						   const SamplingProfile& profile)
+	{
+		for (const auto& stack : profile.m_stacks)
+		{
+			for (std::size_t i = 0u; i < stack.m_frames.size(); ++i)
+			{
+				stream << (0u == i ? "" : ";") << stack.m_frames[i];
+			}
+			stream << ' ' << stack.m_count << '\n';
+		}
+	}
+
+	void WriteSampledSymbolTable(std::ostream& stream,
+								 const SamplingProfile& profile,
+								 std::size_t max_row_count)
+	{
+		const auto symbols = GetSampledSymbols(profile);
+		const auto row_count = (0u == max_row_count)
+							 ? symbols.size()
+							 : std::min(max_row_count, symbols.size());
+		U64 period_count = 0u;
+		for (const auto& stack : profile.m_stacks)
+		{
+			period_count += stack.m_count;
+		}
+		const auto total_count
+			= static_cast< F64 >(std::max< U64 >(period_count, 1u));
+
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << std::right << std::setw(10) << "Self"
+			   << std::setw(9)  << "Self %"
+			   << std::setw(10) << "Total"
+			   << std::setw(9)  << "Total %" << "  Symbol\n";
+
+		stream << std::fixed << std::setprecision(2);
+		for (std::size_t i = 0u; i < row_count; ++i)
+		{
+			const auto& symbol = symbols[i];
+			stream << std::setw(10) << symbol.m_self_count
+				   << std::setw(9)
+				   << 100.0 * static_cast< F64 >(symbol.m_self_count)
+					  / total_count
+				   << std::setw(10) << symbol.m_total_count
+				   << std::setw(9)
+				   << 100.0 * static_cast< F64 >(symbol.m_total_count)
+					  / total_count
+				   << "  " << symbol.m_name << '\n';
+		}
+
+		stream << "Samples: " << profile.m_sample_count
+			   << "  Periods: " << profile.m_period_count
+			   << "  Dropped: " << profile.m_dropped_count
+			   << "  Frequency (Hz): " << profile.m_frequency
+			   << std::setprecision(3)
+			   << "  Handler overhead (%): " << 100.0 * profile.GetOverhead()
+			   << '\n';
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+}
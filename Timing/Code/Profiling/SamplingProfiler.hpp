@@ -0,0 +1,252 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TimeIntervalSeconds
+#include <System/Timer.hpp>
+// F64, U32, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// size_t
+#include <cstddef>
+// ostream
+#include <iosfwd>
+// string
+#include <string>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Sampling Profiles
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of sampled call stacks.
+	 */
+	struct SampledStack
+	{
+		/**
+		 The symbolized frames (from the outermost caller to the sampled
+		 function) of this sampled stack.
+		 */
+		std::vector< std::string > m_frames;
+
+		/**
+		 The number of sampling periods (i.e. the process CPU time in units
+		 of the sampling period) of this sampled stack.
+		 */
+		U64 m_count = 0u;
+	};
+
+	/**
+	 A struct of sampled symbols.
+	 */
+	struct SampledSymbol
+	{
+		/**
+		 The name of this sampled symbol.
+		 */
+		std::string m_name;
+
+		/**
+		 The number of sampling periods in which this sampled symbol is the
+		 sampled function (i.e. the self time).
+		 */
+		U64 m_self_count = 0u;
+
+		/**
+		 The number of sampling periods in which this sampled symbol is on
+		 the stack (i.e. the total time, counting recursive frames once).
+		 */
+		U64 m_total_count = 0u;
+	};
+
+	/**
+	 A struct of sampling profiles.
+	 */
+	struct SamplingProfile
+	{
+		/**
+		 The distinct sampled stacks (sorted by decreasing number of
+		 samples) of this sampling profile.
+		 */
+		std::vector< SampledStack > m_stacks;
+
+		/**
+		 The number of recorded samples (i.e. delivered signals) of this
+		 sampling profile.
+		 */
+		U64 m_sample_count = 0u;
+
+		/**
+		 The number of samples dropped because the sample buffer was full.
+		 */
+		U64 m_dropped_count = 0u;
+
+		/**
+		 The number of elapsed sampling periods (including those coalesced
+		 into a single sample and those of dropped samples) of this sampling
+		 profile.
+		 */
+		U64 m_period_count = 0u;
+
+		/**
+		 The sampling frequency (in samples per second of process CPU time)
+		 of this sampling profile.
+		 */
+		U32 m_frequency = 0u;
+
+		/**
+		 The wall clock time spent in the signal handler of this sampling
+		 profile.
+		 */
+		TimeIntervalSeconds m_handler_time = TimeIntervalSeconds::zero();
+
+		/**
+		 Returns the overhead (i.e. the ratio of the time spent in the signal
+		 handler to the sampled process CPU time) of this sampling profile.
+
+		 @return		The overhead of this sampling profile.
+		 */
+		[[nodiscard]]
+		F64 GetOverhead() const noexcept;
+	};
+
+	//-------------------------------------------------------------------------
+	// Sampling Profiler
+	//-------------------------------------------------------------------------
+
+	/**
+	 Starts the sampling profiler of the calling process, discarding all
+	 previously recorded samples.
+
+	 A POSIX timer on the process CPU time clock (i.e.
+	 @c CLOCK_PROCESS_CPUTIME_ID, the clock of @c CoreClock) raises
+	 @c SIGPROF at the given frequency. The signal handler captures the call
+	 stack of the interrupted thread by walking the frame pointers of the
+	 interrupted context (i.e. not with @c backtrace, whose unwinder takes
+	 the loader lock) into a preallocated sample buffer claimed with a
+	 single atomic increment; it neither locks nor allocates, and is
+	 async-signal-safe. Frame records are validated before being read.
+	 Symbolization happens afterwards in @c GetSamplingProfile.
+
+	 The kernel only checks CPU time timers on scheduler ticks (e.g., every
+	 4 ms for @c CONFIG_HZ=250), so shorter periods are coalesced into a
+	 single signal whose sample is weighted by the number of elapsed
+	 periods (i.e. one plus the timer overruns).
+
+	 Measured overhead at 1 kHz (Linux x86-64, stacks of 5 frames,
+	 @c CONFIG_HZ=250): 0.6 to 1.5 us per signal, i.e. below 0.05% of the
+	 process CPU time with one signal per tick.
+	 @c SamplingProfile::GetOverhead reports the handler time of a profile.
+
+	 @param[in]		frequency
+					The sampling frequency (in samples per second of process
+					CPU time).
+	 @param[in]		capacity
+					The maximum number of samples (each sample occupies
+					about 520 bytes).
+	 @return		@c true if the sampling profiler started. @c false
+					otherwise.
+	 @note			Fails if the sampling profiler is already running, if
+					the frequency or capacity is zero, or on Windows (which
+					provides no @c SIGPROF).
+	 @note			Symbols of the executable itself are only resolved if
+					it exports its dynamic symbols (e.g., @c -rdynamic), and
+					never for functions with internal linkage. Frames
+					without symbol are reported as their bracketed module
+					(e.g., @c [libm.so.6]).
+	 @note			Call stacks are only complete for code compiled with
+					frame pointers (e.g., @c -fno-omit-frame-pointer), and
+					are only captured on x86-64 and AArch64 (i.e. samples
+					are empty otherwise). A sample interrupting a function
+					without frame pointer (or its prologue) misses the
+					caller of that function.
+	 */
+	[[nodiscard]]
+	bool StartSamplingProfiler(U32 frequency = 1000u,
+							   std::size_t capacity = std::size_t(1u) << 15u);
+
+	/**
+	 Stops the sampling profiler of the calling process and waits for
+	 signal handlers in flight to finish. The recorded samples are kept.
+	 */
+	void StopSamplingProfiler();
+
+	/**
+	 Checks whether the sampling profiler of the calling process is
+	 running.
+
+	 @return		@c true if the sampling profiler of the calling process
+					is running. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool IsSamplingProfilerRunning() noexcept;
+
+	/**
+	 Symbolizes and aggregates the samples recorded by the sampling
+	 profiler of the calling process.
+
+	 @return		The sampling profile.
+	 @note			Returns an empty profile while the sampling profiler is
+					running.
+	 */
+	[[nodiscard]]
+	SamplingProfile GetSamplingProfile();
+
+	//-------------------------------------------------------------------------
+	// Sampling Profile Reporting
+	//-------------------------------------------------------------------------
+
+	/**
+	 Returns the sampled symbols of the given sampling profile (sorted by
+	 decreasing self count).
+
+	 @param[in]		profile
+					A reference to the sampling profile.
+	 @return		The sampled symbols of the given sampling profile.
+	 */
+	[[nodiscard]]
+	std::vector< SampledSymbol >
+		GetSampledSymbols(const SamplingProfile& profile);
+
+	/**
+	 Writes the given sampling profile as folded stacks (i.e. one
+	 @c caller;callee;... @c count line per stack, the input format of
+	 flame graph tools) to the given output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		profile
+					A reference to the sampling profile.
+	 */
+	void WriteFoldedStacks(std::ostream& stream,
+						   const SamplingProfile& profile);
+
+	/**
+	 Writes the sampled symbols of the given sampling profile as a self and
+	 total time table to the given output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		profile
+					A reference to the sampling profile.
+	 @param[in]		max_row_count
+					The maximum number of symbols to write, or zero to write
+					all symbols.
+	 */
+	void WriteSampledSymbolTable(std::ostream& stream,
+								 const SamplingProfile& profile,
+								 std::size_t max_row_count = 0u);
+}
@@ -0,0 +1,782 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/SharedTrace.hpp>
+// WriteJsonString
+#include <IO/Json.hpp>
+
+#ifdef _WIN32
+
+// CloseHandle, CreateFileMappingW, CreateFileW, DeleteFileW,
+// GetCurrentProcessId, GetFileSizeEx, GetTempPathW, MapViewOfFile,
+// QueryPerformanceCounter, QueryPerformanceFrequency, UnmapViewOfFile
+#include <System/Windows.hpp>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// min, sort
+#include <algorithm>
+// atomic
+#include <atomic>
+// milliseconds
+#include <chrono>
+// memcpy
+#include <cstring>
+// fixed, setprecision
+#include <iomanip>
+// ostream
+#include <ostream>
+// sleep_for
+#include <thread>
+
+#ifndef _WIN32
+
+// O_CREAT, O_EXCL, O_RDWR
+#include <fcntl.h>
+// mmap, munmap, shm_open, shm_unlink, MAP_FAILED, MAP_SHARED, PROT_READ,
+// PROT_WRITE
+#include <sys/mman.h>
+// fstat, stat
+#include <sys/stat.h>
+// clock_gettime
+#include <time.h>
+// close, ftruncate, getpid
+#include <unistd.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The magic of shared trace regions (i.e. "MAGESHM" followed by a
+		 null character, in little-endian byte order).
+		 */
+		constexpr U64 g_region_magic = 0x004D'4853'4547'414DULL;
+
+		/**
+		 The version of shared trace regions.
+		 */
+		constexpr U32 g_region_version = 2u;
+
+		/**
+		 A struct of headers of shared trace regions.
+		 */
+		struct alignas(64) RegionHeader
+		{
+			/**
+			 The magic of this region header, stored last when the region is
+			 initialized.
+			 */
+			std::atomic< U64 > m_magic;
+
+			/**
+			 The version of this region header.
+			 */
+			U32 m_version;
+
+			/**
+			 The number of segments of this region header.
+			 */
+			U32 m_segment_count;
+
+			/**
+			 The number of trace events per segment of this region header.
+			 */
+			U32 m_segment_capacity;
+
+			/**
+			 The number of claimed segments (which may exceed the number of
+			 segments) of this region header.
+			 */
+			std::atomic< U32 > m_claimed_count;
+		};
+
+		/**
+		 A struct of headers of segments of shared trace regions.
+		 */
+		struct alignas(64) SegmentHeader
+		{
+			/**
+			 The process identifier of the producer of this segment header.
+			 */
+			std::atomic< U32 > m_process_id;
+
+			/**
+			 The number of reserved trace events (which may exceed the
+			 capacity) of this segment header.
+			 */
+			std::atomic< U64 > m_reserved_count;
+		};
+
+		/**
+		 A struct of trace events of shared trace regions.
+		 */
+		struct alignas(64) SharedTraceEvent
+		{
+			/**
+			 The timestamp (in nanoseconds) of this shared trace
+			 event.
+			 */
+			U64 m_timestamp;
+
+			/**
+			 The thread index of this shared trace event.
+			 */
+			U32 m_thread_index;
+
+			/**
+			 Flag indicating whether this shared trace event is committed
+			 (i.e. completely written).
+			 */
+			std::atomic< U32 > m_committed;
+
+			/**
+			 The type of this shared trace event.
+			 */
+			U8 m_type;
+
+			/**
+			 The length of the name of this shared trace event.
+			 */
+			U8 m_name_length;
+
+			/**
+			 The (not null-terminated) name of this shared trace event.
+			 */
+			char m_name[SharedTraceRegion::s_max_name_length];
+		};
+
+		static_assert(64u == sizeof(RegionHeader));
+		static_assert(64u == sizeof(SegmentHeader));
+		static_assert(64u == sizeof(SharedTraceEvent));
+		static_assert(std::atomic< U32 >::is_always_lock_free);
+		static_assert(std::atomic< U64 >::is_always_lock_free);
+
+		/**
+		 Returns the size (in bytes) of a segment of shared trace regions.
+
+		 @param[in]		capacity
+						The number of trace events per segment.
+		 @return		The size of a segment.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t GetSegmentSize(U32 capacity) noexcept
+		{
+			return sizeof(SegmentHeader)
+				 + std::size_t(capacity) * sizeof(SharedTraceEvent);
+		}
+
+		/**
+		 Returns the size (in bytes) of shared trace regions.
+
+		 @param[in]		segment_count
+						The number of segments.
+		 @param[in]		capacity
+						The number of trace events per segment.
+		 @return		The size of a shared trace region.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t GetRegionSize(U32 segment_count,
+											U32 capacity) noexcept
+		{
+			return sizeof(RegionHeader)
+				 + std::size_t(segment_count) * GetSegmentSize(capacity);
+		}
+
+		/**
+		 Returns the identifier of the calling process.
+
+		 @return		The identifier of the calling process.
+		 */
+		[[nodiscard]]
+		U32 GetProcessId() noexcept
+		{
+#ifdef _WIN32
+			return static_cast< U32 >(::GetCurrentProcessId());
+#else
+			return static_cast< U32 >(::getpid());
+#endif
+		}
+
+		/**
+		 Returns the thread index (unique within the process) of the calling
+		 thread.
+
+		 @return		The thread index of the calling thread.
+		 */
+		[[nodiscard]]
+		U32 GetThreadIndex() noexcept
+		{
+			static std::atomic< U32 > s_next_thread_index = 0u;
+			thread_local const U32 thread_index
+				= s_next_thread_index.fetch_add(1u, std::memory_order_relaxed);
+			return thread_index;
+		}
+
+		/**
+		 Returns the Chrome Trace Event phase of the given trace event type.
+
+		 @param[in]		type
+						The trace event type.
+		 @return		The Chrome Trace Event phase of the given trace event
+						type.
+		 */
+		[[nodiscard]]
+		constexpr char ToChromePhase(TraceEventType type) noexcept
+		{
+			switch (type)
+			{
+
+			case TraceEventType::Begin:
+				return 'B';
+			case TraceEventType::End:
+				return 'E';
+			default:
+				return 'i';
+			}
+		}
+
+#ifdef _WIN32
+
+		/**
+		 Returns the path of the file of the shared trace region with the
+		 given name (i.e. in the temporary directory).
+
+		 @param[in]		name
+						The name of the shared trace region.
+		 @return		The path of the file.
+		 */
+		[[nodiscard]]
+		std::wstring GetFilePath(std::string_view name)
+		{
+			wchar_t directory[MAX_PATH + 1u];
+			const auto length = ::GetTempPathW(MAX_PATH + 1u, directory);
+
+			std::wstring path(directory,
+							  (length <= MAX_PATH) ? length : DWORD(0u));
+			path.append(name.cbegin(), name.cend());
+			return path;
+		}
+
+#else
+
+		/**
+		 Returns the name of the shared memory object of the shared trace
+		 region with the given name.
+
+		 @param[in]		name
+						The name of the shared trace region.
+		 @return		The name of the shared memory object.
+		 */
+		[[nodiscard]]
+		std::string GetObjectName(std::string_view name)
+		{
+			std::string object_name = "/";
+			object_name += name;
+			return object_name;
+		}
+
+#endif
+	}
+
+	//-------------------------------------------------------------------------
+	// Shared Trace Time
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	U64 GetSharedTraceTimestamp() noexcept
+	{
+		constexpr U64 nanoseconds_per_second = 1'000'000'000u;
+
+#ifdef _WIN32
+		static const auto s_frequency = []() noexcept
+		{
+			LARGE_INTEGER frequency = {};
+			::QueryPerformanceFrequency(&frequency);
+			return static_cast< U64 >(frequency.QuadPart);
+		}();
+
+		LARGE_INTEGER counter = {};
+		::QueryPerformanceCounter(&counter);
+		const auto ticks = static_cast< U64 >(counter.QuadPart);
+
+		// Splits the conversion to avoid overflowing.
+		return ticks / s_frequency * nanoseconds_per_second
+			 + ticks % s_frequency * nanoseconds_per_second / s_frequency;
+#else
+		timespec time = {};
+		::clock_gettime(CLOCK_MONOTONIC, &time);
+		return static_cast< U64 >(time.tv_sec) * nanoseconds_per_second
+			 + static_cast< U64 >(time.tv_nsec);
+#endif
+	}
+
+	//-------------------------------------------------------------------------
+	// SharedTraceRegion
+	//-------------------------------------------------------------------------
+
+	bool SharedTraceRegion::Remove(std::string_view name)
+	{
+#ifdef _WIN32
+		// Processes which mapped the file keep it until they unmap it.
+		return FALSE != ::DeleteFileW(GetFilePath(name).c_str());
+#else
+		return 0 == ::shm_unlink(GetObjectName(name).c_str());
+#endif
+	}
+
+	SharedTraceRegion::SharedTraceRegion() noexcept
+		: m_data(nullptr),
+		m_size(0u),
+		m_handle(-1)
+	{}
+
+	SharedTraceRegion::~SharedTraceRegion()
+	{
+		Close();
+	}
+
+	[[nodiscard]]
+	bool SharedTraceRegion::Create(std::string_view name,
+								   U32 segment_count,
+								   U32 segment_capacity)
+	{
+		Close();
+
+		if (0u == segment_count || 0u == segment_capacity)
+		{
+			return false;
+		}
+
+		const auto size = GetRegionSize(segment_count, segment_capacity);
+
+#ifdef _WIN32
+		const auto path = GetFilePath(name);
+		const auto file = ::CreateFileW(
+			path.c_str(), GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+			CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (INVALID_HANDLE_VALUE == file)
+		{
+			return false;
+		}
+
+		// The file mapping extends the (zero-filled) file and keeps it open.
+		const auto mapping = ::CreateFileMappingW(
+			file, nullptr, PAGE_READWRITE,
+			static_cast< DWORD >(U64(size) >> 32u),
+			static_cast< DWORD >(U64(size) & 0xFFFFFFFFu),
+			nullptr);
+		::CloseHandle(file);
+		if (nullptr == mapping)
+		{
+			::DeleteFileW(path.c_str());
+			return false;
+		}
+
+		if (!Map(reinterpret_cast< std::intptr_t >(mapping), size))
+		{
+			::CloseHandle(mapping);
+			::DeleteFileW(path.c_str());
+			return false;
+		}
+#else
+		const auto object_name = GetObjectName(name);
+		const auto file = ::shm_open(object_name.c_str(),
+									 O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (-1 == file)
+		{
+			return false;
+		}
+
+		// The shared memory object is zero-filled.
+		const bool mapped
+			= 0 == ::ftruncate(file, static_cast< off_t >(size))
+			&& Map(file, size);
+		::close(file);
+		if (!mapped)
+		{
+			::shm_unlink(object_name.c_str());
+			return false;
+		}
+#endif
+
+		auto& header = *reinterpret_cast< RegionHeader* >(m_data);
+		header.m_version          = g_region_version;
+		header.m_segment_count    = segment_count;
+		header.m_segment_capacity = segment_capacity;
+		header.m_claimed_count.store(0u, std::memory_order_relaxed);
+		// Publishes the initialized region to opening processes.
+		header.m_magic.store(g_region_magic, std::memory_order_release);
+
+		return true;
+	}
+
+	[[nodiscard]]
+	bool SharedTraceRegion::Open(std::string_view name)
+	{
+		Close();
+
+#ifdef _WIN32
+		const auto file = ::CreateFileW(
+			GetFilePath(name).c_str(), GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (INVALID_HANDLE_VALUE == file)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER file_size = {};
+		const auto mapping = (FALSE != ::GetFileSizeEx(file, &file_size)
+			&& sizeof(RegionHeader) <= static_cast< U64 >(file_size.QuadPart))
+			? ::CreateFileMappingW(file, nullptr, PAGE_READWRITE, 0u, 0u,
+								   nullptr)
+			: nullptr;
+		::CloseHandle(file);
+		if (nullptr == mapping)
+		{
+			return false;
+		}
+
+		if (!Map(reinterpret_cast< std::intptr_t >(mapping),
+				 static_cast< std::size_t >(file_size.QuadPart)))
+		{
+			::CloseHandle(mapping);
+			return false;
+		}
+#else
+		const auto file = ::shm_open(GetObjectName(name).c_str(), O_RDWR, 0);
+		if (-1 == file)
+		{
+			return false;
+		}
+
+		struct stat status = {};
+		const bool mapped
+			= 0 == ::fstat(file, &status)
+			&& sizeof(RegionHeader) <= static_cast< std::size_t >(
+				status.st_size)
+			&& Map(file, static_cast< std::size_t >(status.st_size));
+		::close(file);
+		if (!mapped)
+		{
+			return false;
+		}
+#endif
+
+		const auto& header = *reinterpret_cast< const RegionHeader* >(m_data);
+		if (g_region_magic != header.m_magic.load(std::memory_order_acquire)
+			|| g_region_version != header.m_version
+			|| m_size < GetRegionSize(header.m_segment_count,
+									  header.m_segment_capacity))
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void SharedTraceRegion::Close() noexcept
+	{
+		if (nullptr == m_data)
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		::UnmapViewOfFile(m_data);
+		::CloseHandle(reinterpret_cast< HANDLE >(m_handle));
+#else
+		::munmap(m_data, m_size);
+#endif
+
+		m_data   = nullptr;
+		m_size   = 0u;
+		m_handle = -1;
+	}
+
+	[[nodiscard]]
+	bool SharedTraceRegion::Map(std::intptr_t handle,
+								std::size_t size) noexcept
+	{
+#ifdef _WIN32
+		const auto mapping = reinterpret_cast< HANDLE >(handle);
+		const auto data = ::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS,
+										  0u, 0u, size);
+		if (nullptr == data)
+		{
+			return false;
+		}
+
+		m_handle = handle;
+#else
+		const auto data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+								 MAP_SHARED, static_cast< int >(handle), 0);
+		if (MAP_FAILED == data)
+		{
+			return false;
+		}
+#endif
+
+		m_data = static_cast< U8* >(data);
+		m_size = size;
+		return true;
+	}
+
+	[[nodiscard]]
+	U32 SharedTraceRegion::GetSegmentCount() const noexcept
+	{
+		const auto& header = *reinterpret_cast< const RegionHeader* >(m_data);
+		return header.m_segment_count;
+	}
+
+	[[nodiscard]]
+	U32 SharedTraceRegion::ClaimSegment() noexcept
+	{
+		auto& header = *reinterpret_cast< RegionHeader* >(m_data);
+		const auto segment
+			= header.m_claimed_count.fetch_add(1u, std::memory_order_relaxed);
+		if (header.m_segment_count <= segment)
+		{
+			return header.m_segment_count;
+		}
+
+		auto& segment_header = *reinterpret_cast< SegmentHeader* >(
+			m_data + sizeof(RegionHeader)
+			+ segment * GetSegmentSize(header.m_segment_capacity));
+		segment_header.m_process_id.store(GetProcessId(),
+										  std::memory_order_release);
+		return segment;
+	}
+
+	bool SharedTraceRegion::Append(U32 segment, U32 thread_index,
+								   TraceEventType type,
+								   std::string_view name,
+								   U64 timestamp) noexcept
+	{
+		const auto& header = *reinterpret_cast< const RegionHeader* >(m_data);
+		auto* const data = m_data + sizeof(RegionHeader)
+						 + segment * GetSegmentSize(header.m_segment_capacity);
+
+		auto& segment_header = *reinterpret_cast< SegmentHeader* >(data);
+		const auto slot = segment_header.m_reserved_count.fetch_add(
+			1u, std::memory_order_relaxed);
+		if (header.m_segment_capacity <= slot)
+		{
+			return false;
+		}
+
+		auto& event = reinterpret_cast< SharedTraceEvent* >(
+			data + sizeof(SegmentHeader))[slot];
+		const auto length = std::min(name.size(), s_max_name_length);
+		event.m_timestamp    = timestamp;
+		event.m_thread_index = thread_index;
+		event.m_type         = static_cast< U8 >(type);
+		event.m_name_length  = static_cast< U8 >(length);
+		std::memcpy(event.m_name, name.data(), length);
+		// Publishes the event; a crash before this store leaves it
+		// uncommitted.
+		event.m_committed.store(1u, std::memory_order_release);
+
+		return true;
+	}
+
+	[[nodiscard]]
+	std::vector< SharedTraceRecord > SharedTraceRegion::Collect() const
+	{
+		std::vector< SharedTraceRecord > records;
+
+		const auto& header = *reinterpret_cast< const RegionHeader* >(m_data);
+		const auto segment_count = std::min(
+			header.m_claimed_count.load(std::memory_order_relaxed),
+			header.m_segment_count);
+
+		for (U32 i = 0u; i < segment_count; ++i)
+		{
+			const auto* const data
+				= m_data + sizeof(RegionHeader)
+				+ i * GetSegmentSize(header.m_segment_capacity);
+
+			const auto& segment_header
+				= *reinterpret_cast< const SegmentHeader* >(data);
+			const auto process_id = segment_header.m_process_id.load(
+				std::memory_order_acquire);
+			const auto event_count = std::min< U64 >(
+				segment_header.m_reserved_count.load(
+					std::memory_order_relaxed),
+				header.m_segment_capacity);
+
+			const auto* const events
+				= reinterpret_cast< const SharedTraceEvent* >(
+					data + sizeof(SegmentHeader));
+			for (U64 j = 0u; j < event_count; ++j)
+			{
+				const auto& event = events[j];
+				if (0u == event.m_committed.load(std::memory_order_acquire))
+				{
+					// Still being written, or its producer crashed.
+					continue;
+				}
+
+				SharedTraceRecord record;
+				record.m_timestamp    = event.m_timestamp;
+				record.m_process_id   = process_id;
+				record.m_thread_index = event.m_thread_index;
+				record.m_type = static_cast< TraceEventType >(event.m_type);
+				record.m_name.assign(event.m_name,
+									 std::min< std::size_t >(
+										 event.m_name_length,
+										 s_max_name_length));
+				records.push_back(std::move(record));
+			}
+		}
+
+		// Merges the segments in the common clock domain.
+		std::stable_sort(records.begin(), records.end(),
+						 [](const SharedTraceRecord& lhs,
+							const SharedTraceRecord& rhs)
+						 {
+							 return lhs.m_timestamp < rhs.m_timestamp;
+						 });
+
+		return records;
+	}
+
+	[[nodiscard]]
+	U64 SharedTraceRegion::GetDroppedCount() const noexcept
+	{
+		const auto& header = *reinterpret_cast< const RegionHeader* >(m_data);
+		const auto segment_count = std::min(
+			header.m_claimed_count.load(std::memory_order_relaxed),
+			header.m_segment_count);
+
+		U64 count = 0u;
+		for (U32 i = 0u; i < segment_count; ++i)
+		{
+			const auto& segment_header
+				= *reinterpret_cast< const SegmentHeader* >(
+					m_data + sizeof(RegionHeader)
+					+ i * GetSegmentSize(header.m_segment_capacity));
+			const auto reserved_count = segment_header.m_reserved_count.load(
+				std::memory_order_relaxed);
+			if (header.m_segment_capacity < reserved_count)
+			{
+				count += reserved_count - header.m_segment_capacity;
+			}
+		}
+
+		return count;
+	}
+
+	//-------------------------------------------------------------------------
+	// SharedTraceWriter
+	//-------------------------------------------------------------------------
+
+	SharedTraceWriter::SharedTraceWriter(std::string_view name, bool create)
+		: m_region(),
+		m_segment(0u),
+		m_open(false)
+	{
+		if (!create || !m_region.Create(name))
+		{
+			// Another process may still be initializing the region.
+			const auto attempt_count = create ? 100u : 1u;
+			for (auto attempt = 0u; attempt < attempt_count
+				 && !m_region.Open(name); ++attempt)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+		}
+
+		if (!m_region.IsOpen())
+		{
+			return;
+		}
+
+		m_segment = m_region.ClaimSegment();
+		m_open    = m_segment < m_region.GetSegmentCount();
+	}
+
+	[[nodiscard]]
+	bool SharedTraceWriter::IsOpen() const noexcept
+	{
+		return m_open;
+	}
+
+	void SharedTraceWriter::Begin(std::string_view name) noexcept
+	{
+		Record(TraceEventType::Begin, name);
+	}
+
+	void SharedTraceWriter::End(std::string_view name) noexcept
+	{
+		Record(TraceEventType::End, name);
+	}
+
+	void SharedTraceWriter::Instant(std::string_view name) noexcept
+	{
+		Record(TraceEventType::Instant, name);
+	}
+
+	void SharedTraceWriter::Record(TraceEventType type,
+								   std::string_view name) noexcept
+	{
+		if (!m_open)
+		{
+			return;
+		}
+
+		m_region.Append(m_segment, GetThreadIndex(), type, name,
+						GetSharedTraceTimestamp());
+	}
+
+	//-------------------------------------------------------------------------
+	// Shared Trace Reporting
+	//-------------------------------------------------------------------------
+
+	void WriteSharedTraceAsChromeJson(
+		std::ostream& stream, const std::vector< SharedTraceRecord >& records)
+	{
+		const auto origin = records.empty() ? 0u : records.front().m_timestamp;
+
+		const auto flags     = stream.flags();
+		const auto precision = stream.precision();
+		stream << std::fixed << std::setprecision(3);
+
+		stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		for (std::size_t i = 0u; i < records.size(); ++i)
+		{
+			const auto& record = records[i];
+			const auto ts = 1.0e-3 * static_cast< F64 >(
+				record.m_timestamp - origin);
+
+			stream << ((0u == i) ? "\n" : ",\n") << "{\"name\":";
+			WriteJsonString(stream, record.m_name);
+			stream << ",\"ph\":\"" << ToChromePhase(record.m_type) << '"';
+			if (TraceEventType::Instant == record.m_type)
+			{
+				stream << ",\"s\":\"t\"";
+			}
+			stream << ",\"ts\":"   << ts
+				   << ",\"pid\":"  << record.m_process_id
+				   << ",\"tid\":"  << record.m_thread_index << '}';
+		}
+		stream << "\n]}\n";
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+}
@@ -0,0 +1,526 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TraceEventType
+#include <Profiling/TraceRecorder.hpp>
+// U8, U32, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// size_t
+#include <cstddef>
+// intptr_t
+#include <cstdint>
+// ostream
+#include <iosfwd>
+// string
+#include <string>
+// string_view
+#include <string_view>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Shared Trace Time
+	//-------------------------------------------------------------------------
+
+	/**
+	 Returns the current timestamp of the clock of shared trace regions.
+
+	 The clock is monotonic and its domain is shared by all processes of the
+	 machine: @c CLOCK_MONOTONIC on POSIX and the performance counter (i.e.
+	 @c QueryPerformanceCounter) on Windows.
+
+	 @return		The current timestamp (in nanoseconds) of the clock of
+					shared trace regions.
+	 */
+	[[nodiscard]]
+	U64 GetSharedTraceTimestamp() noexcept;
+
+	//-------------------------------------------------------------------------
+	// SharedTraceRecord
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of shared trace records (i.e. collected shared trace events).
+	 */
+	struct SharedTraceRecord
+	{
+		/**
+		 The timestamp (in nanoseconds, see @c GetSharedTraceTimestamp) of
+		 this shared trace record.
+		 */
+		U64 m_timestamp = 0u;
+
+		/**
+		 The process identifier of this shared trace record.
+		 */
+		U32 m_process_id = 0u;
+
+		/**
+		 The thread index (unique within the process) of this shared trace
+		 record.
+		 */
+		U32 m_thread_index = 0u;
+
+		/**
+		 The type of this shared trace record.
+		 */
+		TraceEventType m_type = TraceEventType::Instant;
+
+		/**
+		 The name of this shared trace record.
+		 */
+		std::string m_name;
+	};
+
+	//-------------------------------------------------------------------------
+	// SharedTraceRegion
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of shared trace regions (i.e. named shared memory regions
+	 collecting trace events of multiple processes).
+
+	 The region consists of a header and a fixed number of segments. Each
+	 producer process claims its own segment with a single atomic increment
+	 and appends fixed-size trace events to it: a slot is claimed with an
+	 atomic increment, filled and then published by a release store of its
+	 commit flag. Appending never performs a system call, and events of a
+	 producer which crashed mid-write are simply not committed. Segments
+	 are not reused, so every producer process (including restarts) needs a
+	 free segment, and a full segment drops new events.
+
+	 All timestamps are taken with @c GetSharedTraceTimestamp, whose
+	 monotonic clock domain is shared by all processes of the machine, so
+	 the events of all segments can be merged by timestamp.
+
+	 On POSIX, the region is a shared memory object. On Windows, the region
+	 is a file (in the temporary directory) mapped by all processes, since
+	 a named file mapping is destroyed with its last handle: the region
+	 outlives its producers until it is removed, so it can be collected
+	 offline.
+	 */
+	class SharedTraceRegion
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum length (in characters) of the names of the trace events
+		 of shared trace regions. Longer names are truncated.
+		 */
+		static constexpr std::size_t s_max_name_length = 46u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Removes the shared trace region with the given name. Processes which
+		 mapped the region keep their mapping.
+
+		 @param[in]		name
+						The name of the shared trace region.
+		 @return		@c true if the shared trace region was removed.
+						@c false otherwise.
+		 @note			On Windows, a region with the same name cannot be
+						created until all processes unmapped the removed
+						region.
+		 */
+		static bool Remove(std::string_view name);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a closed shared trace region.
+		 */
+		SharedTraceRegion() noexcept;
+
+		/**
+		 Constructs a shared trace region from the given shared trace
+		 region.
+
+		 @param[in]		region
+						A reference to the shared trace region to copy.
+		 */
+		SharedTraceRegion(const SharedTraceRegion& region) = delete;
+
+		/**
+		 Constructs a shared trace region by moving the given shared trace
+		 region.
+
+		 @param[in]		region
+						A reference to the shared trace region to move.
+		 */
+		SharedTraceRegion(SharedTraceRegion&& region) = delete;
+
+		/**
+		 Destructs this shared trace region. The region is unmapped but not
+		 removed.
+		 */
+		~SharedTraceRegion();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shared trace region to this shared trace region.
+
+		 @param[in]		region
+						A reference to the shared trace region to copy.
+		 @return		A reference to the copy of the given shared trace
+						region (i.e. this shared trace region).
+		 */
+		SharedTraceRegion& operator=(const SharedTraceRegion& region)
+			= delete;
+
+		/**
+		 Moves the given shared trace region to this shared trace region.
+
+		 @param[in]		region
+						A reference to the shared trace region to move.
+		 @return		A reference to the moved shared trace region (i.e.
+						this shared trace region).
+		 */
+		SharedTraceRegion& operator=(SharedTraceRegion&& region) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Creates and maps a new shared trace region with the given name.
+
+		 @param[in]		name
+						The name of the shared trace region.
+		 @param[in]		segment_count
+						The number of segments (i.e. producer processes).
+		 @param[in]		segment_capacity
+						The number of trace events per segment.
+		 @return		@c true if the shared trace region was created.
+						@c false otherwise.
+		 @note			Fails if a region with the given name already exists
+						or if the count or capacity is zero.
+		 */
+		[[nodiscard]]
+		bool Create(std::string_view name,
+					U32 segment_count = 16u,
+					U32 segment_capacity = 16384u);
+
+		/**
+		 Maps the existing shared trace region with the given name.
+
+		 @param[in]		name
+						The name of the shared trace region.
+		 @return		@c true if the shared trace region was opened.
+						@c false otherwise.
+		 @note			Fails if the region does not exist, is not
+						initialized yet or has an unsupported version.
+		 */
+		[[nodiscard]]
+		bool Open(std::string_view name);
+
+		/**
+		 Unmaps this shared trace region.
+		 */
+		void Close() noexcept;
+
+		/**
+		 Checks whether this shared trace region is mapped.
+
+		 @return		@c true if this shared trace region is mapped.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOpen() const noexcept
+		{
+			return nullptr != m_data;
+		}
+
+		/**
+		 Returns the number of segments of this shared trace region.
+
+		 @return		The number of segments of this shared trace region.
+		 */
+		[[nodiscard]]
+		U32 GetSegmentCount() const noexcept;
+
+		/**
+		 Claims a free segment of this shared trace region for the calling
+		 process.
+
+		 @return		The index of the claimed segment, or the number of
+						segments if all segments are claimed.
+		 */
+		[[nodiscard]]
+		U32 ClaimSegment() noexcept;
+
+		/**
+		 Appends a trace event to the given segment of this shared trace
+		 region. This is lock-free and safe to call from multiple threads.
+
+		 @param[in]		segment
+						The index of the segment.
+		 @param[in]		thread_index
+						The thread index.
+		 @param[in]		type
+						The trace event type.
+		 @param[in]		name
+						The name of the trace event.
+		 @param[in]		timestamp
+						The timestamp (in nanoseconds, see
+						@c GetSharedTraceTimestamp).
+		 @return		@c true if the trace event was appended. @c false
+						otherwise (i.e. the segment is full).
+		 */
+		bool Append(U32 segment, U32 thread_index, TraceEventType type,
+					std::string_view name, U64 timestamp) noexcept;
+
+		/**
+		 Collects the committed trace events of all segments of this shared
+		 trace region, merged in timestamp order. This may be called while
+		 producers are appending.
+
+		 @return		The shared trace records.
+		 */
+		[[nodiscard]]
+		std::vector< SharedTraceRecord > Collect() const;
+
+		/**
+		 Returns the number of trace events dropped by all full segments of
+		 this shared trace region.
+
+		 @return		The number of dropped trace events.
+		 */
+		[[nodiscard]]
+		U64 GetDroppedCount() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Maps the given number of bytes of the given shared memory object.
+
+		 @param[in]		handle
+						The shared memory object.
+		 @param[in]		size
+						The size (in bytes) of the shared memory object.
+		 @return		@c true if the shared memory object was mapped.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Map(std::intptr_t handle, std::size_t size) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the mapped data of this shared trace region.
+		 */
+		U8* m_data;
+
+		/**
+		 The mapped size (in bytes) of this shared trace region.
+		 */
+		std::size_t m_size;
+
+		/**
+		 The handle of the file mapping (Windows) of this shared trace
+		 region.
+		 */
+		std::intptr_t m_handle;
+	};
+
+	//-------------------------------------------------------------------------
+	// SharedTraceWriter
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of shared trace writers appending the trace events of the
+	 calling process to its own segment of a shared trace region.
+	 */
+	class SharedTraceWriter
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shared trace writer.
+
+		 @param[in]		name
+						The name of the shared trace region.
+		 @param[in]		create
+						@c true to create the shared trace region if it does
+						not exist yet. @c false otherwise.
+		 @note			If the region cannot be opened or has no free
+						segment, the trace events are discarded (see
+						@c IsOpen).
+		 */
+		explicit SharedTraceWriter(std::string_view name,
+								   bool create = false);
+
+		/**
+		 Constructs a shared trace writer from the given shared trace writer.
+
+		 @param[in]		writer
+						A reference to the shared trace writer to copy.
+		 */
+		SharedTraceWriter(const SharedTraceWriter& writer) = delete;
+
+		/**
+		 Constructs a shared trace writer by moving the given shared trace
+		 writer.
+
+		 @param[in]		writer
+						A reference to the shared trace writer to move.
+		 */
+		SharedTraceWriter(SharedTraceWriter&& writer) = delete;
+
+		/**
+		 Destructs this shared trace writer.
+		 */
+		~SharedTraceWriter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shared trace writer to this shared trace writer.
+
+		 @param[in]		writer
+						A reference to the shared trace writer to copy.
+		 @return		A reference to the copy of the given shared trace
+						writer (i.e. this shared trace writer).
+		 */
+		SharedTraceWriter& operator=(const SharedTraceWriter& writer)
+			= delete;
+
+		/**
+		 Moves the given shared trace writer to this shared trace writer.
+
+		 @param[in]		writer
+						A reference to the shared trace writer to move.
+		 @return		A reference to the moved shared trace writer (i.e.
+						this shared trace writer).
+		 */
+		SharedTraceWriter& operator=(SharedTraceWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this shared trace writer has a segment.
+
+		 @return		@c true if this shared trace writer has a segment.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOpen() const noexcept;
+
+		/**
+		 Records the begin of a zone with the given name.
+
+		 @param[in]		name
+						The name of the zone.
+		 */
+		void Begin(std::string_view name) noexcept;
+
+		/**
+		 Records the end of a zone with the given name.
+
+		 @param[in]		name
+						The name of the zone.
+		 */
+		void End(std::string_view name) noexcept;
+
+		/**
+		 Records an instant event with the given name.
+
+		 @param[in]		name
+						The name of the instant event.
+		 */
+		void Instant(std::string_view name) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records a trace event of the given type with the given name and the
+		 current timestamp.
+
+		 @param[in]		type
+						The trace event type.
+		 @param[in]		name
+						The name of the trace event.
+		 */
+		void Record(TraceEventType type, std::string_view name) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shared trace region of this shared trace writer.
+		 */
+		SharedTraceRegion m_region;
+
+		/**
+		 The index of the segment of this shared trace writer.
+		 */
+		U32 m_segment;
+
+		/**
+		 Flag indicating whether this shared trace writer has a segment.
+		 */
+		bool m_open;
+	};
+
+	//-------------------------------------------------------------------------
+	// Shared Trace Reporting
+	//-------------------------------------------------------------------------
+
+	/**
+	 Writes the given shared trace records in the Chrome Trace Event JSON
+	 format (i.e. one process per producer) to the given output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		records
+					A reference to the shared trace records (in timestamp
+					order).
+	 */
+	void WriteSharedTraceAsChromeJson(
+		std::ostream& stream, const std::vector< SharedTraceRecord >& records);
+}
@@ -0,0 +1,323 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <Profiling/TraceRecorder.hpp>
+// WriteJsonString
+#include <IO/Json.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// remove
+#include <algorithm>
+// fixed, setprecision
+#include <iomanip>
+// ostream
+#include <ostream>
+// shared_ptr
+#include <memory>
+// vector
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		//---------------------------------------------------------------------
+		// Registry
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of registries of trace buffers.
+		 */
+		struct Registry
+		{
+			/**
+			 The mutex guarding this registry.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The registered trace buffers of this registry. Trace buffers
+			 outlive their thread until they are drained.
+			 */
+			std::vector< std::shared_ptr< TraceBuffer > > m_buffers;
+
+			/**
+			 The next thread index of this registry.
+			 */
+			U32 m_next_thread_index = 0u;
+		};
+
+		/**
+		 Returns the registry of trace buffers.
+
+		 @return		A reference to the registry of trace buffers.
+		 */
+		[[nodiscard]]
+		Registry& GetRegistry()
+		{
+			static Registry s_registry;
+			return s_registry;
+		}
+
+		/**
+		 A class of trace buffer handles registering a trace buffer on
+		 construction and retiring it on destruction (i.e. thread exit).
+		 */
+		class TraceBufferHandle
+		{
+
+		public:
+
+			/**
+			 Constructs a trace buffer handle, registering a new trace
+			 buffer.
+			 */
+			TraceBufferHandle()
+			{
+				auto& registry = GetRegistry();
+				const std::scoped_lock lock(registry.m_mutex);
+				m_buffer = std::make_shared< TraceBuffer >(
+					registry.m_next_thread_index++);
+				registry.m_buffers.push_back(m_buffer);
+			}
+
+			TraceBufferHandle(const TraceBufferHandle& handle) = delete;
+
+			TraceBufferHandle(TraceBufferHandle&& handle) = delete;
+
+			/**
+			 Destructs this trace buffer handle, retiring its trace buffer.
+			 */
+			~TraceBufferHandle()
+			{
+				m_buffer->Retire();
+			}
+
+			TraceBufferHandle& operator=(
+				const TraceBufferHandle& handle) = delete;
+
+			TraceBufferHandle& operator=(
+				TraceBufferHandle&& handle) = delete;
+
+			/**
+			 Returns the trace buffer of this trace buffer handle.
+
+			 @return		A reference to the trace buffer of this trace
+							buffer handle.
+			 */
+			[[nodiscard]]
+			TraceBuffer& GetBuffer() const noexcept
+			{
+				return *m_buffer;
+			}
+
+		private:
+
+			/**
+			 A pointer to the trace buffer of this trace buffer handle.
+			 */
+			std::shared_ptr< TraceBuffer > m_buffer;
+		};
+
+		/**
+		 Returns the Chrome trace event phase of the given trace event type.
+
+		 @param[in]		type
+						The trace event type.
+		 @return		The Chrome trace event phase of the given trace event
+						type.
+		 */
+		[[nodiscard]]
+		constexpr char ToChromePhase(TraceEventType type) noexcept
+		{
+			switch (type)
+			{
+
+			case TraceEventType::Begin:
+				return 'B';
+			case TraceEventType::End:
+				return 'E';
+			default:
+				return 'i';
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// TraceBuffer
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	TraceBuffer& TraceBuffer::Get() noexcept
+	{
+		thread_local const TraceBufferHandle s_handle;
+		return s_handle.GetBuffer();
+	}
+
+	TraceBuffer::TraceBuffer(U32 thread_index)
+		: m_events(std::make_unique< TraceEvent[] >(s_capacity)),
+		m_thread_index(thread_index)
+	{}
+
+	//-------------------------------------------------------------------------
+	// Trace Buffer Draining
+	//-------------------------------------------------------------------------
+
+	std::size_t DrainTraceBuffers(
+		const std::function< void(U32, const TraceEvent&) >& action,
+		const std::function< void(U32, U64) >& dropped_action)
+	{
+		std::vector< std::shared_ptr< TraceBuffer > > buffers;
+		{
+			auto& registry = GetRegistry();
+			const std::scoped_lock lock(registry.m_mutex);
+			buffers = registry.m_buffers;
+		}
+
+		std::size_t count = 0u;
+		for (const auto& buffer : buffers)
+		{
+			// The retired flag is checked before draining: a retired trace
+			// buffer does not receive new trace events afterwards.
+			const auto retired = buffer->IsRetired();
+			const auto tid     = buffer->GetThreadIndex();
+
+			count += buffer->Drain([&](const TraceEvent& event)
+			{
+				action(tid, event);
+			});
+
+			if (const auto dropped = buffer->DrainNumberOfDroppedEvents();
+				0u != dropped && dropped_action)
+			{
+				dropped_action(tid, dropped);
+			}
+
+			if (retired)
+			{
+				auto& registry = GetRegistry();
+				const std::scoped_lock lock(registry.m_mutex);
+				auto& registered = registry.m_buffers;
+				registered.erase(std::remove(registered.begin(),
+											 registered.end(), buffer),
+								 registered.end());
+			}
+		}
+
+		return count;
+	}
+
+	//-------------------------------------------------------------------------
+	// ChromeTraceWriter
+	//-------------------------------------------------------------------------
+
+	ChromeTraceWriter::ChromeTraceWriter(std::ostream& stream)
+		: m_stream(&stream),
+		m_origin(static_cast< U64 >(
+			TraceBuffer::ClockType::now().time_since_epoch().count())),
+		m_count(0u),
+		m_flush_mutex(),
+		m_flusher(),
+		m_stop_mutex(),
+		m_stop_condition(),
+		m_stop(false)
+	{
+		*m_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	}
+
+	ChromeTraceWriter::~ChromeTraceWriter()
+	{
+		StopBackgroundFlush();
+		Flush();
+
+		*m_stream << "\n]}\n";
+		m_stream->flush();
+	}
+
+	std::size_t ChromeTraceWriter::Flush()
+	{
+		const std::scoped_lock flush_lock(m_flush_mutex);
+
+		const auto ticks_per_us = TraceBuffer::ClockType::TicksPerSecond()
+								* 1.0e-6;
+		auto& stream = *m_stream;
+		stream << std::fixed << std::setprecision(3);
+
+		const auto to_us = [&](U64 timestamp) noexcept
+		{
+			return (static_cast< F64 >(timestamp)
+				  - static_cast< F64 >(m_origin)) / ticks_per_us;
+		};
+
+		const auto count = DrainTraceBuffers(
+			[&](U32 tid, const TraceEvent& event)
+		{
+			stream << ((0u == m_count++) ? "\n" : ",\n") << "{\"name\":";
+			WriteJsonString(stream, event.m_name);
+			stream << ",\"ph\":\"" << ToChromePhase(event.m_type) << '"';
+			if (TraceEventType::Instant == event.m_type)
+			{
+				stream << ",\"s\":\"t\"";
+			}
+			stream << ",\"ts\":"   << to_us(event.m_timestamp)
+				   << ",\"pid\":0,\"tid\":" << tid << '}';
+		},
+			[&](U32 tid, U64 dropped)
+		{
+			// Reported at the time of the flush, after the drained trace
+			// events of the thread.
+			const auto timestamp = static_cast< U64 >(
+				TraceBuffer::ClockType::now().time_since_epoch().count());
+
+			stream << ((0u == m_count++) ? "\n" : ",\n")
+				   << "{\"name\":\"Dropped trace events\",\"ph\":\"i\""
+				   << ",\"s\":\"t\",\"ts\":" << to_us(timestamp)
+				   << ",\"pid\":0,\"tid\":" << tid
+				   << ",\"args\":{\"count\":" << dropped << "}}";
+		});
+
+		return count;
+	}
+
+	void ChromeTraceWriter::StartBackgroundFlush(
+		std::chrono::milliseconds period)
+	{
+		StopBackgroundFlush();
+
+		m_stop = false;
+		m_flusher = std::thread([this, period]()
+		{
+			std::unique_lock lock(m_stop_mutex);
+			while (!m_stop_condition.wait_for(lock, period,
+											  [this]() { return m_stop; }))
+			{
+				lock.unlock();
+				Flush();
+				lock.lock();
+			}
+		});
+	}
+
+	void ChromeTraceWriter::StopBackgroundFlush()
+	{
+		if (!m_flusher.joinable())
+		{
+			return;
+		}
+
+		{
+			const std::scoped_lock lock(m_stop_mutex);
+			m_stop = true;
+		}
+		m_stop_condition.notify_all();
+		m_flusher.join();
+	}
+}
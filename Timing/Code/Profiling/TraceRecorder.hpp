@@ -0,0 +1,660 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// TscClock
+#include <System/TscClock.hpp>
+// U32, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// atomic
+#include <atomic>
+// milliseconds
+#include <chrono>
+// condition_variable
+#include <condition_variable>
+// size_t
+#include <cstddef>
+// function
+#include <functional>
+// ostream
+#include <iosfwd>
+// unique_ptr
+#include <memory>
+// mutex
+#include <mutex>
+// thread
+#include <thread>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// TraceEvent
+	//-------------------------------------------------------------------------
+
+	/**
+	 An enumeration of the different trace event types.
+	 */
+	enum class TraceEventType : U32
+	{
+		Begin   = 0u,
+		End     = 1u,
+		Instant = 2u
+	};
+
+	/**
+	 A struct of trace events.
+	 */
+	struct TraceEvent
+	{
+		/**
+		 The timestamp (in raw ticks of the trace clock) of this trace event.
+		 */
+		U64 m_timestamp = 0u;
+
+		/**
+		 A pointer to the null-terminated name of this trace event.
+		 */
+		const char* m_name = nullptr;
+
+		/**
+		 The type of this trace event.
+		 */
+		TraceEventType m_type = TraceEventType::Instant;
+	};
+
+	//-------------------------------------------------------------------------
+	// TraceBuffer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of trace buffers (i.e. fixed-size single-producer
+	 single-consumer ring buffers of trace events).
+
+	 The owning thread is the only producer. A full trace buffer drops new
+	 trace events instead of blocking the producer. Zones (i.e. a begin
+	 trace event, its nested trace events and its end trace event) are
+	 dropped as a whole: a begin trace event is only recorded if the trace
+	 buffer has room left for the end trace events of all open zones, and
+	 the nested and end trace events of a dropped begin trace event are
+	 dropped as well. The trace events of a trace buffer are therefore
+	 always properly nested.
+
+	 Recording a trace event costs a counter read plus a few nanoseconds
+	 (see the @c TraceScopeBeginEnd benchmark: 46 ns per begin and end
+	 trace event pair on a virtual machine whose counter read takes 20 ns).
+	 */
+	class TraceBuffer
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The clock type of trace buffers.
+		 */
+		using ClockType = TscClock;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The capacity (i.e. a power of two) of trace buffers.
+		 */
+		static constexpr std::size_t s_capacity = std::size_t(1u) << 16u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the trace buffer of the calling thread.
+
+		 @return		A reference to the trace buffer of the calling thread.
+		 */
+		[[nodiscard]]
+		static TraceBuffer& Get() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a trace buffer.
+
+		 @param[in]		thread_index
+						The index of the thread of the trace buffer.
+		 */
+		explicit TraceBuffer(U32 thread_index);
+
+		/**
+		 Constructs a trace buffer from the given trace buffer.
+
+		 @param[in]		buffer
+						A reference to the trace buffer to copy.
+		 */
+		TraceBuffer(const TraceBuffer& buffer) = delete;
+
+		/**
+		 Constructs a trace buffer by moving the given trace buffer.
+
+		 @param[in]		buffer
+						A reference to the trace buffer to move.
+		 */
+		TraceBuffer(TraceBuffer&& buffer) = delete;
+
+		/**
+		 Destructs this trace buffer.
+		 */
+		~TraceBuffer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given trace buffer to this trace buffer.
+
+		 @param[in]		buffer
+						A reference to the trace buffer to copy.
+		 @return		A reference to the copy of the given trace buffer
+						(i.e. this trace buffer).
+		 */
+		TraceBuffer& operator=(const TraceBuffer& buffer) = delete;
+
+		/**
+		 Moves the given trace buffer to this trace buffer.
+
+		 @param[in]		buffer
+						A reference to the trace buffer to move.
+		 @return		A reference to the moved trace buffer (i.e. this trace
+						buffer).
+		 */
+		TraceBuffer& operator=(TraceBuffer&& buffer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records a trace event with the given type and name at the current
+		 time. Only the owning thread may call this method. Begin and end
+		 trace events must be properly nested (e.g., by using
+		 @c TraceScope).
+
+		 @param[in]		type
+						The type of the trace event.
+		 @param[in]		name
+						A pointer to the null-terminated name of the trace
+						event. The name must outlive this trace buffer (e.g.,
+						a string literal).
+		 */
+		void Record(TraceEventType type, const char* name) noexcept;
+
+		/**
+		 Drains the recorded trace events of this trace buffer. Only a single
+		 consumer may call this method at a time.
+
+		 @tparam		ActionT
+						An action type to perform on each trace event.
+		 @param[in]		action
+						The action to perform on each trace event.
+		 @return		The number of drained trace events.
+		 */
+		template< typename ActionT >
+		std::size_t Drain(ActionT&& action);
+
+		/**
+		 Returns the number of trace events of this trace buffer dropped
+		 since the previous call. Only a single consumer may call this method
+		 at a time.
+
+		 @return		The number of trace events of this trace buffer
+						dropped since the previous call.
+		 */
+		[[nodiscard]]
+		U64 DrainNumberOfDroppedEvents() noexcept
+		{
+			const auto dropped = GetNumberOfDroppedEvents();
+			const auto count   = dropped - m_reported_dropped;
+			m_reported_dropped = dropped;
+			return count;
+		}
+
+		/**
+		 Returns the index of the thread of this trace buffer.
+
+		 @return		The index of the thread of this trace buffer.
+		 */
+		[[nodiscard]]
+		U32 GetThreadIndex() const noexcept
+		{
+			return m_thread_index;
+		}
+
+		/**
+		 Returns the number of dropped trace events of this trace buffer.
+
+		 @return		The number of dropped trace events of this trace
+						buffer.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfDroppedEvents() const noexcept
+		{
+			return m_dropped.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 Checks whether the thread of this trace buffer has exited.
+
+		 @return		@c true if the thread of this trace buffer has exited.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsRetired() const noexcept
+		{
+			return m_retired.load(std::memory_order_acquire);
+		}
+
+		/**
+		 Marks the thread of this trace buffer as exited.
+		 */
+		void Retire() noexcept
+		{
+			m_retired.store(true, std::memory_order_release);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this trace buffer has room for the given number of
+		 trace events. Only the owning thread may call this method.
+
+		 @param[in]		head
+						The write position of this trace buffer.
+		 @param[in]		count
+						The number of trace events.
+		 @return		@c true if this trace buffer has room for the given
+						number of trace events. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasRoom(std::size_t head, std::size_t count) noexcept;
+
+		/**
+		 Drops a trace event of this trace buffer. Only the owning thread
+		 may call this method.
+		 */
+		void Drop() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The trace events of this trace buffer.
+		 */
+		std::unique_ptr< TraceEvent[] > m_events;
+
+		/**
+		 The index of the thread of this trace buffer.
+		 */
+		U32 m_thread_index;
+
+		/**
+		 The write position (i.e. owned by the producer) of this trace
+		 buffer.
+		 */
+		alignas(64) std::atomic< std::size_t > m_head = 0u;
+
+		/**
+		 The cached read position of the producer of this trace buffer.
+		 */
+		std::size_t m_cached_tail = 0u;
+
+		/**
+		 The number of recorded begin trace events of this trace buffer
+		 whose end trace event is not recorded yet.
+		 */
+		std::size_t m_open_depth = 0u;
+
+		/**
+		 The number of dropped begin trace events of this trace buffer whose
+		 end trace event is not dropped yet.
+		 */
+		std::size_t m_dropped_depth = 0u;
+
+		/**
+		 The number of dropped trace events of this trace buffer.
+		 */
+		std::atomic< U64 > m_dropped = 0u;
+
+		/**
+		 Flag indicating whether the thread of this trace buffer has exited.
+		 */
+		std::atomic< bool > m_retired = false;
+
+		/**
+		 The read position (i.e. owned by the consumer) of this trace buffer.
+		 */
+		alignas(64) std::atomic< std::size_t > m_tail = 0u;
+
+		/**
+		 The number of dropped trace events of this trace buffer reported to
+		 the consumer.
+		 */
+		U64 m_reported_dropped = 0u;
+	};
+
+	//-------------------------------------------------------------------------
+	// TraceScope
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of trace scopes recording a begin trace event on construction
+	 and an end trace event on destruction.
+	 */
+	class TraceScope
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a trace scope.
+
+		 @param[in]		name
+						A pointer to the null-terminated name of the trace
+						scope.
+		 */
+		explicit TraceScope(const char* name) noexcept
+			: m_buffer(TraceBuffer::Get()),
+			m_name(name)
+		{
+			m_buffer.Record(TraceEventType::Begin, m_name);
+		}
+
+		/**
+		 Constructs a trace scope from the given trace scope.
+
+		 @param[in]		scope
+						A reference to the trace scope to copy.
+		 */
+		TraceScope(const TraceScope& scope) = delete;
+
+		/**
+		 Constructs a trace scope by moving the given trace scope.
+
+		 @param[in]		scope
+						A reference to the trace scope to move.
+		 */
+		TraceScope(TraceScope&& scope) = delete;
+
+		/**
+		 Destructs this trace scope.
+		 */
+		~TraceScope()
+		{
+			m_buffer.Record(TraceEventType::End, m_name);
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given trace scope to this trace scope.
+
+		 @param[in]		scope
+						A reference to the trace scope to copy.
+		 @return		A reference to the copy of the given trace scope (i.e.
+						this trace scope).
+		 */
+		TraceScope& operator=(const TraceScope& scope) = delete;
+
+		/**
+		 Moves the given trace scope to this trace scope.
+
+		 @param[in]		scope
+						A reference to the trace scope to move.
+		 @return		A reference to the moved trace scope (i.e. this trace
+						scope).
+		 */
+		TraceScope& operator=(TraceScope&& scope) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the trace buffer of this trace scope.
+		 */
+		TraceBuffer& m_buffer;
+
+		/**
+		 A pointer to the null-terminated name of this trace scope.
+		 */
+		const char* m_name;
+	};
+
+	//-------------------------------------------------------------------------
+	// Trace Buffer Draining
+	//-------------------------------------------------------------------------
+
+	/**
+	 Drains the trace buffers of all threads. Trace buffers of exited threads
+	 are unregistered once drained. Only a single consumer may call this
+	 function at a time.
+
+	 @param[in]		action
+					The action to perform on each trace event (given the index
+					of the thread of the trace event and the trace event).
+	 @param[in]		dropped_action
+					The action to perform on each trace buffer that dropped
+					trace events since the previous drain (given the index of
+					the thread of the trace buffer and the number of dropped
+					trace events), if any.
+	 @return		The number of drained trace events.
+	 */
+	std::size_t DrainTraceBuffers(
+		const std::function< void(U32, const TraceEvent&) >& action,
+		const std::function< void(U32, U64) >& dropped_action = {});
+
+	//-------------------------------------------------------------------------
+	// ChromeTraceWriter
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of Chrome trace writers draining the trace buffers of all
+	 threads into the Chrome Trace Event JSON format (which can be loaded in
+	 chrome://tracing and Perfetto).
+	 */
+	class ChromeTraceWriter
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a Chrome trace writer.
+
+		 @param[in,out]	stream
+						A reference to the output stream. The output stream
+						must outlive this Chrome trace writer.
+		 */
+		explicit ChromeTraceWriter(std::ostream& stream);
+
+		/**
+		 Constructs a Chrome trace writer from the given Chrome trace writer.
+
+		 @param[in]		writer
+						A reference to the Chrome trace writer to copy.
+		 */
+		ChromeTraceWriter(const ChromeTraceWriter& writer) = delete;
+
+		/**
+		 Constructs a Chrome trace writer by moving the given Chrome trace
+		 writer.
+
+		 @param[in]		writer
+						A reference to the Chrome trace writer to move.
+		 */
+		ChromeTraceWriter(ChromeTraceWriter&& writer) = delete;
+
+		/**
+		 Destructs this Chrome trace writer. The background flusher is
+		 stopped, the remaining trace events are flushed and the JSON
+		 document is closed.
+		 */
+		~ChromeTraceWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given Chrome trace writer to this Chrome trace writer.
+
+		 @param[in]		writer
+						A reference to the Chrome trace writer to copy.
+		 @return		A reference to the copy of the given Chrome trace
+						writer (i.e. this Chrome trace writer).
+		 */
+		ChromeTraceWriter& operator=(const ChromeTraceWriter& writer) = delete;
+
+		/**
+		 Moves the given Chrome trace writer to this Chrome trace writer.
+
+		 @param[in]		writer
+						A reference to the Chrome trace writer to move.
+		 @return		A reference to the moved Chrome trace writer (i.e. this
+						Chrome trace writer).
+		 */
+		ChromeTraceWriter& operator=(ChromeTraceWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Drains the trace buffers of all threads and writes their trace
+		 events. Trace events dropped since the previous flush are written
+		 as an instant trace event (named "Dropped trace events", with the
+		 number of dropped trace events as argument) per thread.
+
+		 @return		The number of written trace events.
+		 */
+		std::size_t Flush();
+
+		/**
+		 Starts flushing periodically on a background thread.
+
+		 @param[in]		period
+						The flush period.
+		 */
+		void StartBackgroundFlush(std::chrono::milliseconds period);
+
+		/**
+		 Stops flushing periodically on a background thread.
+		 */
+		void StopBackgroundFlush();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the output stream of this Chrome trace writer.
+		 */
+		std::ostream* m_stream;
+
+		/**
+		 The origin timestamp (in raw ticks of the trace clock) of this Chrome
+		 trace writer.
+		 */
+		U64 m_origin;
+
+		/**
+		 The number of written trace events of this Chrome trace writer.
+		 */
+		std::size_t m_count;
+
+		/**
+		 The mutex serializing the flushes of this Chrome trace writer.
+		 */
+		std::mutex m_flush_mutex;
+
+		/**
+		 The background flusher of this Chrome trace writer.
+		 */
+		std::thread m_flusher;
+
+		/**
+		 The mutex guarding the stop flag of this Chrome trace writer.
+		 */
+		std::mutex m_stop_mutex;
+
+		/**
+		 The condition variable signaling the stop flag of this Chrome trace
+		 writer.
+		 */
+		std::condition_variable m_stop_condition;
+
+		/**
+		 Flag indicating whether the background flusher of this Chrome trace
+		 writer must stop.
+		 */
+		bool m_stop;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Defines
+//-----------------------------------------------------------------------------
+
+#define MAGE_TRACE_CONCAT_IMPL(a, b) a##b
+#define MAGE_TRACE_CONCAT(a, b) MAGE_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ Traces the remainder of the enclosing scope with the given name.
+ */
+#define MAGE_TRACE_SCOPE(name)                                                \
+	const mage::TraceScope                                                    \
+		MAGE_TRACE_CONCAT(mage_trace_scope_, __LINE__)(name)
+
+/**
+ Traces an instant with the given name.
+ */
+#define MAGE_TRACE_INSTANT(name)                                              \
+	mage::TraceBuffer::Get().Record(mage::TraceEventType::Instant, name)
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Profiling/TraceRecorder.inl>
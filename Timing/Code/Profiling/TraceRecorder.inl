@@ -0,0 +1,92 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	inline void TraceBuffer::Record(TraceEventType type,
+									const char* name) noexcept
+	{
+		const auto timestamp = static_cast< U64 >(
+			ClockType::now().time_since_epoch().count());
+
+		const auto head = m_head.load(std::memory_order_relaxed);
+		switch (type)
+		{
+
+		case TraceEventType::Begin:
+			// Reserves room for the end trace events of all open zones.
+			if (0u != m_dropped_depth || !HasRoom(head, m_open_depth + 2u))
+			{
+				++m_dropped_depth;
+				Drop();
+				return;
+			}
+			++m_open_depth;
+			break;
+		case TraceEventType::End:
+			// The room of the end trace event of an open zone is reserved.
+			if (0u != m_dropped_depth || 0u == m_open_depth)
+			{
+				m_dropped_depth -= (0u != m_dropped_depth) ? 1u : 0u;
+				Drop();
+				return;
+			}
+			--m_open_depth;
+			break;
+		default:
+			if (0u != m_dropped_depth || !HasRoom(head, m_open_depth + 1u))
+			{
+				Drop();
+				return;
+			}
+			break;
+		}
+
+		auto& event = m_events[head & (s_capacity - 1u)];
+		event.m_timestamp = timestamp;
+		event.m_name      = name;
+		event.m_type      = type;
+
+		// Publishes the trace event to the consumer.
+		m_head.store(head + 1u, std::memory_order_release);
+	}
+
+	[[nodiscard]]
+	inline bool TraceBuffer::HasRoom(std::size_t head,
+									 std::size_t count) noexcept
+	{
+		if (s_capacity - (head - m_cached_tail) < count)
+		{
+			// Only reload the read position of the consumer when the trace
+			// buffer appears to be full.
+			m_cached_tail = m_tail.load(std::memory_order_acquire);
+			return count <= s_capacity - (head - m_cached_tail);
+		}
+
+		return true;
+	}
+
+	inline void TraceBuffer::Drop() noexcept
+	{
+		m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1u,
+						std::memory_order_relaxed);
+	}
+
+	template< typename ActionT >
+	inline std::size_t TraceBuffer::Drain(ActionT&& action)
+	{
+		const auto tail = m_tail.load(std::memory_order_relaxed);
+		const auto head = m_head.load(std::memory_order_acquire);
+
+		for (auto i = tail; i != head; ++i)
+		{
+			action(m_events[i & (s_capacity - 1u)]);
+		}
+
+		// Releases the slots to the producer.
+		m_tail.store(head, std::memory_order_release);
+		return head - tail;
+	}
+}
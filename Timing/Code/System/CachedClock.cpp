@@ -0,0 +1,341 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <System/CachedClock.hpp>
+
+#ifdef _WIN32
+
+// GetSystemTimeAdjustment
+#include <System/Windows.hpp>
+// QueryInterruptTime, QueryInterruptTimePrecise
+#include <realtimeapiset.h>
+
+#pragma comment(lib, "mincore.lib")
+
+#endif
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// condition_variable
+#include <condition_variable>
+// mutex
+#include <mutex>
+// thread
+#include <thread>
+
+#ifndef _WIN32
+
+// clock_getres, clock_gettime, timespec, CLOCK_MONOTONIC,
+// CLOCK_MONOTONIC_COARSE
+#include <time.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+#ifdef _WIN32
+
+		/**
+		 Returns the current precise monotonic timestamp (in 100 ns).
+
+		 @return		The current precise monotonic timestamp.
+		 */
+		[[nodiscard]]
+		U64 PreciseTimestamp() noexcept
+		{
+			ULONGLONG timestamp;
+			::QueryInterruptTimePrecise(&timestamp);
+			return timestamp;
+		}
+
+		/**
+		 Returns the resolution of the coarse monotonic clock.
+
+		 @return		The resolution of the coarse monotonic clock.
+		 */
+		[[nodiscard]]
+		std::chrono::microseconds CoarseResolution() noexcept
+		{
+			// The interrupt time is updated once per clock interrupt.
+			DWORD adjustment;
+			DWORD increment;
+			BOOL  disabled;
+			if (FALSE == ::GetSystemTimeAdjustment(&adjustment,
+												   &increment,
+												   &disabled))
+			{
+				// The default clock interrupt period.
+				return std::chrono::microseconds(15625);
+			}
+
+			// The clock interrupt period is expressed in 100 ns.
+			return std::chrono::microseconds(increment / 10u);
+		}
+
+#else
+
+		/**
+		 Converts the given timespec to a timestamp (in 1 ns).
+
+		 @param[in]		time
+						A reference to the timespec.
+		 @return		The timestamp.
+		 */
+		[[nodiscard]]
+		constexpr U64 ConvertTimestamp(const timespec& time) noexcept
+		{
+			return static_cast< U64 >(time.tv_sec) * 1'000'000'000u
+				 + static_cast< U64 >(time.tv_nsec);
+		}
+
+		/**
+		 Returns the current precise monotonic timestamp (in 1 ns).
+
+		 @return		The current precise monotonic timestamp.
+		 */
+		[[nodiscard]]
+		U64 PreciseTimestamp() noexcept
+		{
+			timespec time = {};
+			::clock_gettime(CLOCK_MONOTONIC, &time);
+			return ConvertTimestamp(time);
+		}
+
+		/**
+		 Returns the resolution of the coarse monotonic clock.
+
+		 @return		The resolution of the coarse monotonic clock.
+		 */
+		[[nodiscard]]
+		std::chrono::microseconds CoarseResolution() noexcept
+		{
+			timespec resolution = {};
+			::clock_getres(CLOCK_MONOTONIC_COARSE, &resolution);
+			return std::chrono::microseconds(
+				ConvertTimestamp(resolution) / 1'000u);
+		}
+
+#endif
+
+		/**
+		 A class of tickers refreshing a cached timestamp on a background
+		 thread.
+		 */
+		class Ticker
+		{
+
+		public:
+
+			/**
+			 Constructs a ticker.
+			 */
+			Ticker() noexcept
+				: m_ticker(),
+				m_staleness(0),
+				m_stop_mutex(),
+				m_stop_condition(),
+				m_stop(false)
+			{}
+
+			/**
+			 Constructs a ticker from the given ticker.
+
+			 @param[in]		ticker
+							A reference to the ticker to copy.
+			 */
+			Ticker(const Ticker& ticker) = delete;
+
+			/**
+			 Constructs a ticker by moving the given ticker.
+
+			 @param[in]		ticker
+							A reference to the ticker to move.
+			 */
+			Ticker(Ticker&& ticker) = delete;
+
+			/**
+			 Destructs this ticker.
+			 */
+			~Ticker()
+			{
+				Stop();
+			}
+
+			/**
+			 Copies the given ticker to this ticker.
+
+			 @param[in]		ticker
+							A reference to the ticker to copy.
+			 @return		A reference to the copy of the given ticker (i.e.
+							this ticker).
+			 */
+			Ticker& operator=(const Ticker& ticker) = delete;
+
+			/**
+			 Moves the given ticker to this ticker.
+
+			 @param[in]		ticker
+							A reference to the ticker to move.
+			 @return		A reference to the moved ticker (i.e. this ticker).
+			 */
+			Ticker& operator=(Ticker&& ticker) = delete;
+
+			/**
+			 Starts refreshing the given timestamp periodically.
+
+			 @param[in,out]	timestamp
+							A reference to the timestamp.
+			 @param[in]		staleness
+							The refresh period.
+			 */
+			void Start(std::atomic< U64 >& timestamp,
+					   std::chrono::microseconds staleness)
+			{
+				Stop();
+
+				timestamp.store(PreciseTimestamp(), std::memory_order_relaxed);
+
+				m_staleness.store(staleness.count(), std::memory_order_relaxed);
+				m_stop = false;
+				m_ticker = std::thread([this, &timestamp, staleness]()
+				{
+					std::unique_lock lock(m_stop_mutex);
+					while (!m_stop_condition.wait_for(
+						lock, staleness, [this]() { return m_stop; }))
+					{
+						timestamp.store(PreciseTimestamp(),
+										std::memory_order_relaxed);
+					}
+				});
+			}
+
+			/**
+			 Stops refreshing the timestamp periodically.
+			 */
+			void Stop()
+			{
+				if (!m_ticker.joinable())
+				{
+					return;
+				}
+
+				{
+					const std::scoped_lock lock(m_stop_mutex);
+					m_stop = true;
+				}
+				m_stop_condition.notify_all();
+				m_ticker.join();
+
+				m_staleness.store(0, std::memory_order_relaxed);
+			}
+
+			/**
+			 Returns the refresh period of this ticker.
+
+			 @return		The refresh period of this ticker, or zero if this
+							ticker is not running.
+			 */
+			[[nodiscard]]
+			std::chrono::microseconds GetStaleness() const noexcept
+			{
+				return std::chrono::microseconds(
+					m_staleness.load(std::memory_order_relaxed));
+			}
+
+		private:
+
+			/**
+			 The background thread of this ticker.
+			 */
+			std::thread m_ticker;
+
+			/**
+			 The refresh period (in microseconds) of this ticker.
+			 */
+			std::atomic< std::chrono::microseconds::rep > m_staleness;
+
+			/**
+			 The mutex guarding the stop flag of this ticker.
+			 */
+			std::mutex m_stop_mutex;
+
+			/**
+			 The condition variable signaling the stop flag of this ticker.
+			 */
+			std::condition_variable m_stop_condition;
+
+			/**
+			 Flag indicating whether the background thread of this ticker
+			 must stop.
+			 */
+			bool m_stop;
+		};
+
+		/**
+		 The mutex serializing starting and stopping the ticker.
+		 */
+		std::mutex g_ticker_mutex;
+
+		/**
+		 The ticker of the cached clock.
+		 */
+		Ticker g_ticker;
+	}
+
+	std::atomic< U64 > CachedClock::s_timestamp = 0u;
+
+	std::atomic< U64 > CachedClock::s_floor = 0u;
+
+	void CachedClock::StartTicker(std::chrono::microseconds staleness)
+	{
+		const std::scoped_lock lock(g_ticker_mutex);
+		g_ticker.Start(s_timestamp, staleness);
+	}
+
+	void CachedClock::StopTicker()
+	{
+		const std::scoped_lock lock(g_ticker_mutex);
+		g_ticker.Stop();
+
+		const auto timestamp = s_timestamp.load(std::memory_order_relaxed);
+		if (0u != timestamp)
+		{
+			// The coarse clock may lag behind the last cached timestamp by up
+			// to one scheduler tick. The release store publishes the floor to
+			// readers observing the reset.
+			s_floor.store(timestamp, std::memory_order_relaxed);
+			s_timestamp.store(0u, std::memory_order_release);
+		}
+	}
+
+	[[nodiscard]]
+	std::chrono::microseconds CachedClock::GetStaleness() noexcept
+	{
+		const auto staleness = g_ticker.GetStaleness();
+		return (std::chrono::microseconds::zero() != staleness)
+			 ? staleness : CoarseResolution();
+	}
+
+	[[nodiscard]]
+	U64 CachedClock::CoarseTimestamp() noexcept
+	{
+#ifdef _WIN32
+		ULONGLONG timestamp;
+		::QueryInterruptTime(&timestamp);
+		return timestamp;
+#else
+		timespec time = {};
+		::clock_gettime(CLOCK_MONOTONIC_COARSE, &time);
+		return ConvertTimestamp(time);
+#endif
+	}
+}
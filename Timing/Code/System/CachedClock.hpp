@@ -0,0 +1,113 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// SystemTimePeriod
+#include <System/SystemTime.hpp>
+// U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// atomic
+#include <atomic>
+// duration, microseconds, time_point
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Cached Time
+	//-------------------------------------------------------------------------
+
+	/**
+	 A monotonic clock trading accuracy for a cheap @c now (e.g., for
+	 timeouts and metrics on hot paths).
+
+	 While the ticker is running, @c now is a single relaxed atomic load of
+	 a timestamp which the ticker thread refreshes at the configured
+	 staleness. Otherwise, @c now reads the coarse monotonic clock of the
+	 operating system (i.e. @c CLOCK_MONOTONIC_COARSE on Linux and
+	 @c QueryInterruptTime on Windows), which is updated once per scheduler
+	 tick (i.e. typically every 1 to 16 ms). Both sources share the epoch of
+	 the precise monotonic clock of the operating system.
+	 */
+	struct CachedClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< CachedClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+
+		/**
+		 Starts (or restarts) the ticker thread refreshing the cached
+		 timestamp.
+
+		 @param[in]		staleness
+						The maximum staleness (i.e. the refresh period) of
+						the cached timestamp.
+		 @note			@c now never goes back when the ticker is stopped,
+						even though the coarse clock may lag behind the
+						cached timestamp by up to one scheduler tick.
+		 */
+		static void StartTicker(std::chrono::microseconds staleness
+								= std::chrono::microseconds(1000));
+
+		/**
+		 Stops the ticker thread refreshing the cached timestamp. @c now
+		 falls back to the coarse monotonic clock of the operating system,
+		 clamped to the last cached timestamp.
+		 */
+		static void StopTicker();
+
+		/**
+		 Returns the maximum staleness of this clock.
+
+		 @return		The refresh period of the ticker thread if running,
+						otherwise the resolution of the coarse monotonic
+						clock of the operating system.
+		 */
+		[[nodiscard]]
+		static std::chrono::microseconds GetStaleness() noexcept;
+
+	private:
+
+		/**
+		 Returns the current timestamp of the coarse monotonic clock of the
+		 operating system.
+
+		 @return		The current timestamp of the coarse monotonic clock of
+						the operating system.
+		 */
+		[[nodiscard]]
+		static U64 CoarseTimestamp() noexcept;
+
+		/**
+		 The cached timestamp (zero while the ticker is not running).
+		 */
+		static std::atomic< U64 > s_timestamp;
+
+		/**
+		 The last cached timestamp before the ticker stopped (i.e. a lower
+		 bound of @c now while the ticker is not running).
+		 */
+		static std::atomic< U64 > s_floor;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/CachedClock.inl>
@@ -0,0 +1,29 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	[[nodiscard]]
+	inline auto CachedClock::now() noexcept -> time_point
+	{
+		const auto timestamp = s_timestamp.load(std::memory_order_relaxed);
+		if (0u != timestamp)
+		{
+			return time_point(duration(timestamp));
+		}
+
+		// Synchronizes with the reset of the timestamp in StopTicker.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return time_point(duration(std::max(
+			CoarseTimestamp(), s_floor.load(std::memory_order_relaxed))));
+	}
+}
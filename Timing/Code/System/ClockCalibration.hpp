@@ -0,0 +1,126 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// F64, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// duration
+#include <chrono>
+// size_t
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// ClockCalibration
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of measured characteristics of a clock.
+
+	 The @a period of a clock only states the unit of its durations, not the
+	 granularity at which its time points advance (e.g., CPU time clocks
+	 often advance in scheduler ticks) nor the cost of reading it.
+
+	 @tparam		ClockT
+					The clock type.
+	 */
+	template< typename ClockT >
+	struct ClockCalibration
+	{
+		/**
+		 The time interval type of clock calibrations.
+		 */
+		using TimeInterval = typename ClockT::duration;
+
+		/**
+		 The average cost (in seconds of the steady clock) of a single
+		 @c now() call of the clock.
+		 */
+		std::chrono::duration< F64 > m_now_cost = {};
+
+		/**
+		 The effective resolution (i.e. the smallest observed non-zero
+		 difference between consecutive time points) of the clock. Zero if
+		 the clock did not advance during the calibration.
+		 */
+		TimeInterval m_resolution = TimeInterval::zero();
+
+		/**
+		 The median difference between two back-to-back time points of the
+		 clock, the latter read with @c NowFenced (i.e. the measurement
+		 overhead of an empty interval of a timer as observed by the clock
+		 itself).
+		 */
+		TimeInterval m_overhead = TimeInterval::zero();
+
+		/**
+		 Flag indicating whether no time point of the clock went backwards
+		 during the calibration.
+		 */
+		bool m_monotonic = true;
+	};
+
+	/**
+	 Returns the current timestamp of the given clock ending a measured
+	 interval.
+
+	 Clocks with a serializing read (e.g., @c TscClock) provide a static
+	 @c NowFenced member method which is used instead of @c now, so the
+	 measured instructions complete before the timestamp is taken.
+
+	 @tparam		ClockT
+					The clock type.
+	 @param[in]		clock
+					A reference to the clock.
+	 @return		The current timestamp of the given clock.
+	 */
+	template< typename ClockT >
+	[[nodiscard]]
+	typename ClockT::time_point NowFenced(ClockT& clock) noexcept;
+
+	/**
+	 Calibrates the given clock type.
+
+	 @tparam		ClockT
+					The clock type.
+	 @param[in]		sample_count
+					The number of samples per measured characteristic.
+					The overhead uses at most 1000 samples.
+	 @return		The clock calibration of the given clock type.
+	 @note			The calibration busy-waits for at most a few hundred
+					milliseconds (for clocks advancing in scheduler ticks).
+	 */
+	template< typename ClockT >
+	[[nodiscard]]
+	ClockCalibration< ClockT > CalibrateClock(
+		std::size_t sample_count = 1000u) noexcept;
+
+	/**
+	 Returns the clock calibration of the given clock type. The clock type is
+	 calibrated once on first use.
+
+	 @tparam		ClockT
+					The clock type.
+	 @return		A reference to the clock calibration of the given clock
+					type.
+	 */
+	template< typename ClockT >
+	[[nodiscard]]
+	const ClockCalibration< ClockT >& GetClockCalibration() noexcept;
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/ClockCalibration.inl>
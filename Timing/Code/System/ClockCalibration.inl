@@ -0,0 +1,125 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max, min, nth_element
+#include <algorithm>
+// array
+#include <array>
+// steady_clock
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename ClockT >
+	[[nodiscard]]
+	inline typename ClockT::time_point NowFenced(ClockT& clock) noexcept
+	{
+		if constexpr (requires { ClockT::NowFenced(); })
+		{
+			return ClockT::NowFenced();
+		}
+		else
+		{
+			return clock.now();
+		}
+	}
+
+	template< typename ClockT >
+	[[nodiscard]]
+	ClockCalibration< ClockT > CalibrateClock(std::size_t sample_count) noexcept
+	{
+		using TimeInterval = typename ClockT::duration;
+		using std::chrono::steady_clock;
+
+		ClockCalibration< ClockT > calibration;
+		ClockT clock = {};
+		sample_count = std::max(sample_count, std::size_t(1u));
+
+		// Cost: the average duration of a burst of now() calls.
+		{
+			auto previous = clock.now();
+			const auto start = steady_clock::now();
+			for (std::size_t i = 0u; i < sample_count; ++i)
+			{
+				const auto current = clock.now();
+				calibration.m_monotonic &= !(current < previous);
+				previous = current;
+			}
+			const auto end = steady_clock::now();
+
+			calibration.m_now_cost
+				= std::chrono::duration< F64 >(end - start)
+				/ static_cast< F64 >(sample_count);
+		}
+
+		// Overhead: the median difference of back-to-back now() and
+		// NowFenced() calls (i.e. the reads starting and ending a measured
+		// interval of a timer).
+		{
+			constexpr std::size_t max_delta_count = 1000u;
+			std::array< TimeInterval, max_delta_count > deltas;
+			const auto delta_count = std::min(sample_count, max_delta_count);
+			for (std::size_t i = 0u; i < delta_count; ++i)
+			{
+				auto& delta = deltas[i];
+				const auto first  = clock.now();
+				const auto second = NowFenced(clock);
+				calibration.m_monotonic &= !(second < first);
+				delta = (first < second)
+					  ? second - first : TimeInterval::zero();
+			}
+
+			const auto end    = deltas.begin() + delta_count;
+			const auto middle = deltas.begin() + delta_count / 2u;
+			std::nth_element(deltas.begin(), middle, end);
+			calibration.m_overhead = *middle;
+		}
+
+		// Resolution: the smallest observed step of the clock, spinning until
+		// the clock advances within a bounded time budget.
+		{
+			constexpr std::size_t step_count = 16u;
+			const auto deadline
+				= steady_clock::now() + std::chrono::milliseconds(250);
+
+			for (std::size_t i = 0u; i < step_count; ++i)
+			{
+				const auto first = clock.now();
+				auto current = first;
+				while (!(first < current))
+				{
+					calibration.m_monotonic &= !(current < first);
+					if (deadline < steady_clock::now())
+					{
+						return calibration;
+					}
+
+					current = clock.now();
+				}
+
+				const auto step = current - first;
+				if (TimeInterval::zero() == calibration.m_resolution
+					|| step < calibration.m_resolution)
+				{
+					calibration.m_resolution = step;
+				}
+			}
+		}
+
+		return calibration;
+	}
+
+	template< typename ClockT >
+	[[nodiscard]]
+	inline const ClockCalibration< ClockT >& GetClockCalibration() noexcept
+	{
+		static const auto s_calibration = CalibrateClock< ClockT >();
+		return s_calibration;
+	}
+}
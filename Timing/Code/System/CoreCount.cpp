@@ -0,0 +1,423 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <System/CoreCount.hpp>
+
+#ifdef _WIN32
+
+// GetCurrentProcess, GetProcessAffinityMask, GetSystemInfo
+#include <System/Windows.hpp>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// max, min
+#include <algorithm>
+// atomic
+#include <atomic>
+// popcount
+#include <bit>
+// ceil
+#include <cmath>
+// strtod
+#include <cstdlib>
+// ifstream
+#include <fstream>
+// mutex, scoped_lock
+#include <mutex>
+// getline, string
+#include <string>
+// string_view
+#include <string_view>
+// move
+#include <utility>
+
+#ifndef _WIN32
+
+// CPU_ALLOC, CPU_ALLOC_SIZE, CPU_COUNT_S, CPU_FREE, sched_getaffinity
+#include <sched.h>
+// getpid, sysconf, _SC_NPROCESSORS_CONF, _SC_NPROCESSORS_ONLN
+#include <unistd.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The cached effective number of cores (zero if not computed yet).
+		 */
+		std::atomic< std::size_t > g_effective_core_count = 0u;
+
+		/**
+		 The override of the effective number of cores (zero if not set).
+		 */
+		std::atomic< std::size_t > g_core_count_override = 0u;
+
+		/**
+		 The mutex guarding the cgroup file system root and the computation
+		 of the effective number of cores.
+		 */
+		std::mutex g_cgroup_mutex;
+
+		/**
+		 The path of the cgroup file system root.
+		 */
+		std::filesystem::path g_cgroup_root = "/sys/fs/cgroup";
+
+		/**
+		 The path of the cgroup membership file of the calling process.
+		 */
+		std::filesystem::path g_cgroup_membership = "/proc/self/cgroup";
+
+#ifndef _WIN32
+
+		/**
+		 Returns the path (relative to the cgroup file system root) of the
+		 cgroup of the calling process for the given controller.
+
+		 @param[in]		membership
+						A reference to the path of the cgroup membership file
+						(e.g., @c /proc/self/cgroup).
+		 @param[in]		controller
+						The cgroup v1 controller (or empty for the cgroup v2
+						unified hierarchy).
+		 @return		The relative path of the cgroup of the calling process
+						for the given controller, or an empty path if not
+						found.
+		 */
+		[[nodiscard]]
+		std::filesystem::path GetCgroupPath(
+			const std::filesystem::path& membership,
+			std::string_view controller)
+		{
+			// Each line has the format: hierarchy-ID:controller-list:path
+			std::ifstream file(membership);
+			std::string line;
+			while (std::getline(file, line))
+			{
+				const auto first  = line.find(':');
+				const auto second = line.find(':', first + 1u);
+				if (std::string::npos == first || std::string::npos == second)
+				{
+					continue;
+				}
+
+				const std::string_view controllers(
+					line.data() + first + 1u, second - first - 1u);
+
+				// The cgroup v2 unified hierarchy has an empty controller list.
+				bool match = controllers.empty() && controller.empty();
+				std::size_t begin = 0u;
+				while (!match && !controller.empty()
+					   && begin < controllers.size())
+				{
+					auto end = controllers.find(',', begin);
+					if (std::string_view::npos == end)
+					{
+						end = controllers.size();
+					}
+
+					match = (controllers.substr(begin, end - begin)
+							 == controller);
+					begin = end + 1u;
+				}
+
+				if (match)
+				{
+					return std::filesystem::path(line.substr(second + 1u))
+						.relative_path().lexically_normal();
+				}
+			}
+
+			return {};
+		}
+
+		/**
+		 Returns the minimum CPU bandwidth quota (in cores) over the given
+		 cgroup and all its ancestors.
+
+		 @tparam		ReadQuotaT
+						The type of the function reading the quota of a
+						single cgroup directory (returning zero if
+						unlimited).
+		 @param[in]		root
+						A reference to the path of the cgroup hierarchy root.
+		 @param[in]		path
+						A reference to the path of the cgroup relative to the
+						given root.
+		 @param[in]		read_quota
+						The function reading the quota of a single cgroup
+						directory.
+		 @return		The minimum CPU bandwidth quota (in cores), or zero if
+						unlimited.
+		 */
+		template< typename ReadQuotaT >
+		[[nodiscard]]
+		F64 GetMinimumQuota(const std::filesystem::path& root,
+							std::filesystem::path path,
+							ReadQuotaT read_quota)
+		{
+			// Paths outside the root (e.g., due to a cgroup namespace) are
+			// only checked at the root.
+			if (!path.empty() && *path.begin() == "..")
+			{
+				path.clear();
+			}
+
+			F64 min_quota = 0.0;
+			for (;;)
+			{
+				const auto quota = read_quota(root / path);
+				if (0.0 < quota && (0.0 == min_quota || quota < min_quota))
+				{
+					min_quota = quota;
+				}
+
+				if (path.empty() || path == path.parent_path())
+				{
+					break;
+				}
+
+				path = path.parent_path();
+			}
+
+			return min_quota;
+		}
+
+		/**
+		 Reads the cgroup v2 CPU bandwidth quota (in cores) of the given
+		 cgroup directory.
+
+		 @param[in]		directory
+						A reference to the path of the cgroup directory.
+		 @return		The CPU bandwidth quota (in cores), or zero if
+						unlimited or absent.
+		 */
+		[[nodiscard]]
+		F64 ReadCpuMax(const std::filesystem::path& directory)
+		{
+			// The format is: $MAX $PERIOD (with $MAX possibly "max").
+			std::ifstream file(directory / "cpu.max");
+			std::string quota;
+			F64 period = 0.0;
+			if (!(file >> quota >> period) || "max" == quota
+				|| 0.0 >= period)
+			{
+				return 0.0;
+			}
+
+			return std::strtod(quota.c_str(), nullptr) / period;
+		}
+
+		/**
+		 Reads the cgroup v1 CPU bandwidth quota (in cores) of the given
+		 cgroup directory.
+
+		 @param[in]		directory
+						A reference to the path of the cgroup directory.
+		 @return		The CPU bandwidth quota (in cores), or zero if
+						unlimited or absent.
+		 */
+		[[nodiscard]]
+		F64 ReadCfsQuota(const std::filesystem::path& directory)
+		{
+			// A quota of -1 means unlimited.
+			std::ifstream quota_file(directory / "cpu.cfs_quota_us");
+			std::ifstream period_file(directory / "cpu.cfs_period_us");
+			F64 quota  = 0.0;
+			F64 period = 0.0;
+			if (!(quota_file >> quota) || !(period_file >> period)
+				|| 0.0 >= quota || 0.0 >= period)
+			{
+				return 0.0;
+			}
+
+			return quota / period;
+		}
+
+#endif
+
+		/**
+		 Computes the effective number of cores of the calling process.
+
+		 @param[in]		root
+						A reference to the path of the cgroup file system
+						root.
+		 @param[in]		membership
+						A reference to the path of the cgroup membership
+						file.
+		 @return		The effective number of cores of the calling process
+						(at least 1).
+		 */
+		[[nodiscard]]
+		std::size_t ComputeEffectiveCoreCount(
+			const std::filesystem::path& root,
+			const std::filesystem::path& membership) noexcept
+		{
+			auto count = GetAffinityCoreCount();
+
+			// File system errors are treated as an unlimited bandwidth.
+			F64 quota = 0.0;
+			try
+			{
+				quota = GetCgroupCoreQuota(root, membership);
+			}
+			catch (...)
+			{
+				quota = 0.0;
+			}
+
+			if (0.0 < quota)
+			{
+				count = std::min(count,
+								 static_cast< std::size_t >(std::ceil(quota)));
+			}
+
+			return std::max(count, std::size_t(1u));
+		}
+	}
+
+#ifdef _WIN32
+
+	[[nodiscard]]
+	std::size_t GetSystemCoreCount() noexcept
+	{
+		SYSTEM_INFO system_info = {};
+		::GetSystemInfo(&system_info);
+
+		// Return the number of logical processors in the current group.
+		return system_info.dwNumberOfProcessors;
+	}
+
+	[[nodiscard]]
+	std::size_t GetAffinityCoreCount() noexcept
+	{
+		DWORD_PTR process_mask = 0u;
+		DWORD_PTR system_mask  = 0u;
+		// Retrieve the affinity mask of the process (in the current group).
+		if (FALSE == ::GetProcessAffinityMask(::GetCurrentProcess(),
+											  &process_mask,
+											  &system_mask)
+			|| 0u == process_mask)
+		{
+			return GetSystemCoreCount();
+		}
+
+		return static_cast< std::size_t >(std::popcount(process_mask));
+	}
+
+	[[nodiscard]]
+	F64 GetCgroupCoreQuota(const std::filesystem::path& root,
+						   const std::filesystem::path& membership)
+	{
+		// Windows has no cgroups.
+		static_cast< void >(root);
+		static_cast< void >(membership);
+		return 0.0;
+	}
+
+#else
+
+	[[nodiscard]]
+	std::size_t GetSystemCoreCount() noexcept
+	{
+		// Return the number of logical processors currently online.
+		const auto count = ::sysconf(_SC_NPROCESSORS_ONLN);
+		return (0 < count) ? static_cast< std::size_t >(count) : 1u;
+	}
+
+	[[nodiscard]]
+	std::size_t GetAffinityCoreCount() noexcept
+	{
+		// The mask must cover all configured (not only online) processors.
+		const auto configured = ::sysconf(_SC_NPROCESSORS_CONF);
+		const auto capacity = std::max(static_cast< std::size_t >(
+			(0 < configured) ? configured : 0), std::size_t(1024u));
+
+		const auto set = CPU_ALLOC(capacity);
+		if (nullptr == set)
+		{
+			return GetSystemCoreCount();
+		}
+
+		const auto size = CPU_ALLOC_SIZE(capacity);
+		CPU_ZERO_S(size, set);
+		// Retrieve the affinity mask of the main thread (whose thread
+		// identifier is the process identifier) instead of the calling
+		// thread, which may have been pinned to a subset of the cores.
+		const auto count = (0 == ::sched_getaffinity(::getpid(), size, set))
+						 ? static_cast< std::size_t >(CPU_COUNT_S(size, set))
+						 : 0u;
+		CPU_FREE(set);
+
+		return (0u < count) ? count : GetSystemCoreCount();
+	}
+
+	[[nodiscard]]
+	F64 GetCgroupCoreQuota(const std::filesystem::path& root,
+						   const std::filesystem::path& membership)
+	{
+		const auto quota = GetMinimumQuota(
+			root, GetCgroupPath(membership, {}), ReadCpuMax);
+		if (0.0 < quota)
+		{
+			return quota;
+		}
+
+		return GetMinimumQuota(root / "cpu", GetCgroupPath(membership, "cpu"),
+							   ReadCfsQuota);
+	}
+
+#endif
+
+	[[nodiscard]]
+	std::size_t GetEffectiveCoreCount() noexcept
+	{
+		const auto count
+			= g_effective_core_count.load(std::memory_order_relaxed);
+		return (0u != count) ? count : RefreshEffectiveCoreCount();
+	}
+
+	std::size_t RefreshEffectiveCoreCount() noexcept
+	{
+		const std::scoped_lock lock(g_cgroup_mutex);
+
+		const auto override_count
+			= g_core_count_override.load(std::memory_order_relaxed);
+		const auto count = (0u != override_count)
+						 ? override_count
+						 : ComputeEffectiveCoreCount(g_cgroup_root,
+													 g_cgroup_membership);
+
+		g_effective_core_count.store(count, std::memory_order_relaxed);
+		return count;
+	}
+
+	void SetEffectiveCoreCountOverride(std::size_t count) noexcept
+	{
+		g_core_count_override.store(count, std::memory_order_relaxed);
+		RefreshEffectiveCoreCount();
+	}
+
+	void SetCgroupRoot(std::filesystem::path root,
+					   std::filesystem::path membership)
+	{
+		{
+			const std::scoped_lock lock(g_cgroup_mutex);
+			g_cgroup_root       = std::move(root);
+			g_cgroup_membership = std::move(membership);
+		}
+
+		RefreshEffectiveCoreCount();
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// F64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// size_t
+#include <cstddef>
+// path
+#include <filesystem>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Core Count
+	//-------------------------------------------------------------------------
+
+	/**
+	 Returns the number of system cores (i.e. logical processors).
+
+	 @return		The number of system cores (i.e. logical processors).
+	 */
+	[[nodiscard]]
+	std::size_t GetSystemCoreCount() noexcept;
+
+	/**
+	 Returns the number of cores the calling process may run on (i.e. the
+	 number of logical processors in its affinity mask). On Linux, this is
+	 the affinity mask of the main thread, independent of the affinity mask
+	 of the calling thread.
+
+	 @return		The number of cores the calling process may run on.
+	 @note			If the retrieval fails, the number of system cores is
+					returned.
+	 */
+	[[nodiscard]]
+	std::size_t GetAffinityCoreCount() noexcept;
+
+	/**
+	 Returns the CPU bandwidth quota (in cores) of the cgroup of the calling
+	 process. The quota is the minimum over the cgroup and all its ancestors
+	 of the cgroup v2 @c cpu.max quota divided by its period. If no cgroup v2
+	 limit is found, the cgroup v1 @c cpu.cfs_quota_us and
+	 @c cpu.cfs_period_us of the @c cpu controller are used instead.
+
+	 @param[in]		root
+					A reference to the path of the cgroup file system root
+					(e.g., @c /sys/fs/cgroup).
+	 @param[in]		membership
+					A reference to the path of the cgroup membership file
+					listing the cgroup of the calling process per hierarchy
+					(e.g., @c /proc/self/cgroup).
+	 @return		The CPU bandwidth quota (in cores) of the cgroup of the
+					calling process (e.g., 1.5), or zero if the bandwidth is
+					unlimited or cannot be determined.
+	 @note			Throws on file system or allocation errors (e.g.,
+					@c std::filesystem::filesystem_error).
+	 */
+	[[nodiscard]]
+	F64 GetCgroupCoreQuota(const std::filesystem::path& root,
+						   const std::filesystem::path& membership
+						   = "/proc/self/cgroup");
+
+	/**
+	 Returns the effective number of cores of the calling process (i.e. the
+	 divisor of the per-core clocks). This is the override if set, and
+	 otherwise the minimum of the affinity core count and the cgroup CPU
+	 bandwidth quota (rounded up). The value is computed on first use and
+	 cached until refreshed.
+
+	 @return		The effective number of cores of the calling process (at
+					least 1).
+	 */
+	[[nodiscard]]
+	std::size_t GetEffectiveCoreCount() noexcept;
+
+	/**
+	 Recomputes the cached effective number of cores of the calling process
+	 (e.g., after its affinity mask or cgroup limits changed).
+
+	 @return		The effective number of cores of the calling process (at
+					least 1).
+	 */
+	std::size_t RefreshEffectiveCoreCount() noexcept;
+
+	/**
+	 Overrides the effective number of cores of the calling process.
+
+	 @param[in]		count
+					The effective number of cores. Zero removes the override
+					and refreshes the effective number of cores.
+	 */
+	void SetEffectiveCoreCountOverride(std::size_t count) noexcept;
+
+	/**
+	 Sets the paths of the cgroup file system root and the cgroup membership
+	 file used for computing the effective number of cores (e.g., of a fake
+	 file system tree), and refreshes the effective number of cores.
+
+	 @param[in]		root
+					The path of the cgroup file system root (by default,
+					@c /sys/fs/cgroup).
+	 @param[in]		membership
+					The path of the cgroup membership file (by default,
+					@c /proc/self/cgroup).
+	 */
+	void SetCgroupRoot(std::filesystem::path root,
+					   std::filesystem::path membership = "/proc/self/cgroup");
+}
@@ -0,0 +1,600 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Timer, WallClockTimer
+#include <System/Timer.hpp>
+// U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// high_resolution_clock
+#include <chrono>
+// coroutine_handle
+#include <coroutine>
+// conditional_t, decay_t, is_lvalue_reference_v
+#include <type_traits>
+// declval, forward
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// CoroutineTimer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of timers measuring the active time, suspended time and number
+	 of resumptions of a single coroutine frame.
+
+	 The active timer is stopped whenever the coroutine suspends and resumed
+	 whenever the coroutine resumes, so its total delta time only covers the
+	 time the coroutine actually runs. Since every active interval starts
+	 and ends on the same thread, a thread core clock (e.g.,
+	 @c ThreadCoreClock) measures the CPU time of the coroutine even if it
+	 resumes on different threads. The suspended time is always measured
+	 with the wall clock.
+
+	 @tparam		ClockT
+					The clock type of the active timer.
+	 */
+	template< typename ClockT = std::chrono::high_resolution_clock >
+	class CoroutineTimer
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a coroutine timer.
+		 */
+		CoroutineTimer() noexcept = default;
+
+		/**
+		 Constructs a coroutine timer from the given coroutine timer.
+
+		 @param[in]		timer
+						A reference to the coroutine timer to copy.
+		 */
+		CoroutineTimer(const CoroutineTimer& timer) noexcept = default;
+
+		/**
+		 Constructs a coroutine timer by moving the given coroutine timer.
+
+		 @param[in]		timer
+						A reference to the coroutine timer to move.
+		 */
+		CoroutineTimer(CoroutineTimer&& timer) noexcept = default;
+
+		/**
+		 Destructs this coroutine timer.
+		 */
+		~CoroutineTimer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given coroutine timer to this coroutine timer.
+
+		 @param[in]		timer
+						A reference to the coroutine timer to copy.
+		 @return		A reference to the copy of the given coroutine timer
+						(i.e. this coroutine timer).
+		 */
+		CoroutineTimer& operator=(const CoroutineTimer& timer) noexcept
+			= default;
+
+		/**
+		 Moves the given coroutine timer to this coroutine timer.
+
+		 @param[in]		timer
+						A reference to the coroutine timer to move.
+		 @return		A reference to the moved coroutine timer (i.e. this
+						coroutine timer).
+		 */
+		CoroutineTimer& operator=(CoroutineTimer&& timer) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts this coroutine timer (i.e. the coroutine starts running).
+		 */
+		void Start() noexcept;
+
+		/**
+		 Notifies this coroutine timer that the coroutine suspends.
+		 */
+		void Suspend() noexcept;
+
+		/**
+		 Notifies this coroutine timer that the coroutine resumes. This
+		 counts as a resumption if the coroutine was suspended.
+		 */
+		void Resume() noexcept;
+
+		/**
+		 Notifies this coroutine timer that the coroutine did not suspend
+		 after all (i.e. @c await_suspend returned @c false). This does not
+		 count as a resumption.
+		 */
+		void CancelSuspend() noexcept;
+
+		/**
+		 Stops this coroutine timer (i.e. the coroutine finishes).
+		 */
+		void Stop() noexcept;
+
+		/**
+		 Checks whether the coroutine of this coroutine timer is suspended.
+
+		 @return		@c true if the coroutine of this coroutine timer is
+						suspended. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsSuspended() const noexcept
+		{
+			return m_suspended;
+		}
+
+		/**
+		 Returns the number of resumptions of the coroutine of this
+		 coroutine timer.
+
+		 @return		The number of resumptions of the coroutine of this
+						coroutine timer.
+		 */
+		[[nodiscard]]
+		U64 GetResumeCount() const noexcept
+		{
+			return m_resume_count;
+		}
+
+		/**
+		 Returns the active time (i.e. the time spent running) of the
+		 coroutine of this coroutine timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		The active time of the coroutine of this coroutine
+						timer.
+		 @note			While the coroutine runs, this must be called from
+						the thread running the coroutine.
+		 */
+		template< typename TimeIntervalT >
+		TimeIntervalT ActiveTime() noexcept;
+
+		/**
+		 Returns the suspended time (i.e. the wall clock time spent
+		 suspended) of the coroutine of this coroutine timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		The suspended time of the coroutine of this
+						coroutine timer.
+		 */
+		template< typename TimeIntervalT >
+		TimeIntervalT SuspendedTime() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The timer measuring the active time of this coroutine timer.
+		 */
+		Timer< ClockT > m_active_timer;
+
+		/**
+		 The timer measuring the suspended time of this coroutine timer.
+		 */
+		WallClockTimer m_suspended_timer;
+
+		/**
+		 The number of resumptions of this coroutine timer.
+		 */
+		U64 m_resume_count = 0u;
+
+		/**
+		 Flag indicating whether the coroutine of this coroutine timer is
+		 suspended.
+		 */
+		bool m_suspended = false;
+	};
+
+	//-------------------------------------------------------------------------
+	// TimedAwaiter
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of awaiters notifying a coroutine timer when the awaiting
+	 coroutine suspends and resumes, and forwarding everything else to the
+	 wrapped awaiter.
+
+	 @tparam		AwaiterT
+					The wrapped awaiter type (an lvalue reference type for
+					awaiters which are not owned).
+	 @tparam		ClockT
+					The clock type of the coroutine timer.
+	 */
+	template< typename AwaiterT, typename ClockT >
+	class TimedAwaiter
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a timed awaiter.
+
+		 @tparam		ArgT
+						The wrapped awaiter argument type.
+		 @param[in]		awaiter
+						A reference to the wrapped awaiter.
+		 @param[in]		timer
+						A reference to the coroutine timer.
+		 */
+		template< typename ArgT >
+		explicit TimedAwaiter(ArgT&& awaiter,
+							  CoroutineTimer< ClockT >& timer) noexcept
+			: m_awaiter(std::forward< ArgT >(awaiter)),
+			m_timer(&timer)
+		{}
+
+		/**
+		 Constructs a timed awaiter from the given timed awaiter.
+
+		 @param[in]		awaiter
+						A reference to the timed awaiter to copy.
+		 */
+		TimedAwaiter(const TimedAwaiter& awaiter) = delete;
+
+		/**
+		 Constructs a timed awaiter by moving the given timed awaiter.
+
+		 @param[in]		awaiter
+						A reference to the timed awaiter to move.
+		 */
+		TimedAwaiter(TimedAwaiter&& awaiter) noexcept = default;
+
+		/**
+		 Destructs this timed awaiter.
+		 */
+		~TimedAwaiter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given timed awaiter to this timed awaiter.
+
+		 @param[in]		awaiter
+						A reference to the timed awaiter to copy.
+		 @return		A reference to the copy of the given timed awaiter
+						(i.e. this timed awaiter).
+		 */
+		TimedAwaiter& operator=(const TimedAwaiter& awaiter) = delete;
+
+		/**
+		 Moves the given timed awaiter to this timed awaiter.
+
+		 @param[in]		awaiter
+						A reference to the timed awaiter to move.
+		 @return		A reference to the moved timed awaiter (i.e. this
+						timed awaiter).
+		 */
+		TimedAwaiter& operator=(TimedAwaiter&& awaiter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the wrapped awaiter of this timed awaiter is ready.
+
+		 @return		@c true if the wrapped awaiter of this timed awaiter
+						is ready. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool await_ready();
+
+		/**
+		 Suspends the coroutine timer and forwards to the wrapped awaiter of
+		 this timed awaiter.
+
+		 @tparam		PromiseT
+						The promise type.
+		 @param[in]		handle
+						The handle of the awaiting coroutine.
+		 @return		The result of the wrapped awaiter of this timed
+						awaiter.
+		 @note			The coroutine timer is not accessed after forwarding
+						unless the wrapped awaiter declined to suspend, as
+						the coroutine may already be resumed (or destroyed)
+						on another thread.
+		 */
+		template< typename PromiseT >
+		auto await_suspend(std::coroutine_handle< PromiseT > handle);
+
+		/**
+		 Resumes the coroutine timer and forwards to the wrapped awaiter of
+		 this timed awaiter.
+
+		 @return		The result of the wrapped awaiter of this timed
+						awaiter.
+		 */
+		decltype(auto) await_resume();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The wrapped awaiter of this timed awaiter.
+		 */
+		AwaiterT m_awaiter;
+
+		/**
+		 A pointer to the coroutine timer of this timed awaiter.
+		 */
+		CoroutineTimer< ClockT >* m_timer;
+	};
+
+	/**
+	 Returns the awaiter of the given awaitable (i.e. the result of its
+	 member or non-member @c operator @c co_await, or the awaitable itself).
+
+	 @tparam		AwaitableT
+					The awaitable type.
+	 @param[in]		awaitable
+					A reference to the awaitable.
+	 @return		The awaiter of the given awaitable.
+	 */
+	template< typename AwaitableT >
+	[[nodiscard]]
+	decltype(auto) GetAwaiter(AwaitableT&& awaitable);
+
+	/**
+	 The awaiter types stored by timed awaiters (i.e. references to
+	 awaiters returned as lvalues, and values otherwise).
+
+	 @tparam		AwaitableT
+					The awaitable type.
+	 */
+	template< typename AwaitableT >
+	using TimedAwaiterStorage = std::conditional_t<
+		std::is_lvalue_reference_v<
+			decltype(GetAwaiter(std::declval< AwaitableT >())) >,
+		decltype(GetAwaiter(std::declval< AwaitableT >())),
+		std::decay_t< decltype(GetAwaiter(std::declval< AwaitableT >())) > >;
+
+	//-------------------------------------------------------------------------
+	// TimedPromise
+	//-------------------------------------------------------------------------
+
+	/**
+	 A base class of coroutine promise types timing the coroutine frame of
+	 the promise. The coroutine timer lives in the promise and thus in the
+	 coroutine frame itself, without additional allocations.
+
+	 Every @c co_await in the coroutine body is wrapped in a timed awaiter
+	 (see @c await_transform). The initial and final suspend points must be
+	 routed through @c TimedInitialSuspend and @c TimedFinalSuspend, and
+	 the suspend points of @c co_yield (which bypass @c await_transform)
+	 through @c TimedYield:
+
+	 @code
+	 struct promise_type : mage::TimedPromise<>
+	 {
+		 auto initial_suspend() noexcept
+		 {
+			 return TimedInitialSuspend(std::suspend_always{});
+		 }
+
+		 auto final_suspend() noexcept
+		 {
+			 return TimedFinalSuspend(std::suspend_always{});
+		 }
+
+		 auto yield_value(int value) noexcept
+		 {
+			 m_value = value;
+			 return TimedYield(std::suspend_always{});
+		 }
+		 ...
+	 };
+	 @endcode
+
+	 The coroutine timer of a finished coroutine is accessible through its
+	 handle (i.e. @c handle.promise().GetCoroutineTimer()).
+
+	 @tparam		ClockT
+					The clock type of the active timer.
+	 @note			A derived promise type declaring its own
+					@c await_transform hides the one of this promise.
+	 */
+	template< typename ClockT = std::chrono::high_resolution_clock >
+	class TimedPromise
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Wraps the given awaitable of a @c co_await expression in the
+		 coroutine body in a timed awaiter.
+
+		 @tparam		AwaitableT
+						The awaitable type.
+		 @param[in]		awaitable
+						A reference to the awaitable.
+		 @return		The timed awaiter.
+		 */
+		template< typename AwaitableT >
+		[[nodiscard]]
+		TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >
+			await_transform(AwaitableT&& awaitable);
+
+		/**
+		 Returns the coroutine timer of this timed promise.
+
+		 @return		A reference to the coroutine timer of this timed
+						promise.
+		 */
+		[[nodiscard]]
+		CoroutineTimer< ClockT >& GetCoroutineTimer() noexcept
+		{
+			return m_timer;
+		}
+
+	protected:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a timed promise. The coroutine timer starts when the
+		 coroutine frame is created.
+		 */
+		TimedPromise() noexcept;
+
+		/**
+		 Constructs a timed promise from the given timed promise.
+
+		 @param[in]		promise
+						A reference to the timed promise to copy.
+		 */
+		TimedPromise(const TimedPromise& promise) = delete;
+
+		/**
+		 Constructs a timed promise by moving the given timed promise.
+
+		 @param[in]		promise
+						A reference to the timed promise to move.
+		 */
+		TimedPromise(TimedPromise&& promise) = delete;
+
+		/**
+		 Destructs this timed promise.
+		 */
+		~TimedPromise() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given timed promise to this timed promise.
+
+		 @param[in]		promise
+						A reference to the timed promise to copy.
+		 @return		A reference to the copy of the given timed promise
+						(i.e. this timed promise).
+		 */
+		TimedPromise& operator=(const TimedPromise& promise) = delete;
+
+		/**
+		 Moves the given timed promise to this timed promise.
+
+		 @param[in]		promise
+						A reference to the timed promise to move.
+		 @return		A reference to the moved timed promise (i.e. this
+						timed promise).
+		 */
+		TimedPromise& operator=(TimedPromise&& promise) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Wraps the given awaitable of the initial suspend point in a timed
+		 awaiter. The time between the creation and the first resumption of
+		 a lazily started coroutine counts as suspended time.
+
+		 @tparam		AwaitableT
+						The awaitable type.
+		 @param[in]		awaitable
+						A reference to the awaitable.
+		 @return		The timed awaiter.
+		 */
+		template< typename AwaitableT >
+		[[nodiscard]]
+		TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >
+			TimedInitialSuspend(AwaitableT&& awaitable);
+
+		/**
+		 Wraps the given awaitable of a @c co_yield expression (i.e. returned
+		 by @c yield_value) in a timed awaiter. The time until the consumer
+		 resumes the coroutine counts as suspended time, and the resumption
+		 counts as a resumption.
+
+		 @tparam		AwaitableT
+						The awaitable type.
+		 @param[in]		awaitable
+						A reference to the awaitable.
+		 @return		The timed awaiter.
+		 */
+		template< typename AwaitableT >
+		[[nodiscard]]
+		TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >
+			TimedYield(AwaitableT&& awaitable);
+
+		/**
+		 Stops the coroutine timer and returns the given awaitable of the
+		 final suspend point.
+
+		 @tparam		AwaitableT
+						The awaitable type.
+		 @param[in]		awaitable
+						A reference to the awaitable.
+		 @return		The given awaitable (i.e. a reference to an lvalue
+						awaitable, or the moved rvalue awaitable).
+		 */
+		template< typename AwaitableT >
+		[[nodiscard]]
+		AwaitableT TimedFinalSuspend(AwaitableT&& awaitable) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The coroutine timer of this timed promise.
+		 */
+		CoroutineTimer< ClockT > m_timer;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/CoroutineTimer.inl>
@@ -0,0 +1,192 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// CoroutineTimer
+	//-------------------------------------------------------------------------
+
+	template< typename ClockT >
+	inline void CoroutineTimer< ClockT >::Start() noexcept
+	{
+		m_resume_count = 0u;
+		m_suspended    = false;
+		m_active_timer.Start();
+	}
+
+	template< typename ClockT >
+	inline void CoroutineTimer< ClockT >::Suspend() noexcept
+	{
+		if (m_suspended)
+		{
+			return;
+		}
+
+		m_suspended = true;
+		m_active_timer.Stop();
+		m_suspended_timer.Resume();
+	}
+
+	template< typename ClockT >
+	inline void CoroutineTimer< ClockT >::Resume() noexcept
+	{
+		if (!m_suspended)
+		{
+			return;
+		}
+
+		CancelSuspend();
+		++m_resume_count;
+	}
+
+	template< typename ClockT >
+	inline void CoroutineTimer< ClockT >::CancelSuspend() noexcept
+	{
+		if (!m_suspended)
+		{
+			return;
+		}
+
+		m_suspended = false;
+		m_suspended_timer.Stop();
+		m_active_timer.Resume();
+	}
+
+	template< typename ClockT >
+	inline void CoroutineTimer< ClockT >::Stop() noexcept
+	{
+		m_suspended = false;
+		m_suspended_timer.Stop();
+		m_active_timer.Stop();
+	}
+
+	template< typename ClockT >
+	template< typename TimeIntervalT >
+	inline TimeIntervalT CoroutineTimer< ClockT >::ActiveTime() noexcept
+	{
+		return m_active_timer.template TotalDeltaTime< TimeIntervalT >();
+	}
+
+	template< typename ClockT >
+	template< typename TimeIntervalT >
+	inline TimeIntervalT CoroutineTimer< ClockT >::SuspendedTime() noexcept
+	{
+		return m_suspended_timer.template TotalDeltaTime< TimeIntervalT >();
+	}
+
+	//-------------------------------------------------------------------------
+	// TimedAwaiter
+	//-------------------------------------------------------------------------
+
+	template< typename AwaiterT, typename ClockT >
+	[[nodiscard]]
+	inline bool TimedAwaiter< AwaiterT, ClockT >::await_ready()
+	{
+		return m_awaiter.await_ready();
+	}
+
+	template< typename AwaiterT, typename ClockT >
+	template< typename PromiseT >
+	inline auto TimedAwaiter< AwaiterT, ClockT >
+		::await_suspend(std::coroutine_handle< PromiseT > handle)
+	{
+		using ResultT = decltype(m_awaiter.await_suspend(handle));
+
+		m_timer->Suspend();
+
+		if constexpr (std::is_same_v< ResultT, bool >)
+		{
+			// The coroutine continues immediately if the wrapped awaiter
+			// declines to suspend.
+			const bool suspended = m_awaiter.await_suspend(handle);
+			if (!suspended)
+			{
+				m_timer->CancelSuspend();
+			}
+			return suspended;
+		}
+		else
+		{
+			return m_awaiter.await_suspend(handle);
+		}
+	}
+
+	template< typename AwaiterT, typename ClockT >
+	inline decltype(auto) TimedAwaiter< AwaiterT, ClockT >::await_resume()
+	{
+		m_timer->Resume();
+		return m_awaiter.await_resume();
+	}
+
+	template< typename AwaitableT >
+	[[nodiscard]]
+	inline decltype(auto) GetAwaiter(AwaitableT&& awaitable)
+	{
+		if constexpr (requires { std::forward< AwaitableT >(awaitable)
+									 .operator co_await(); })
+		{
+			return std::forward< AwaitableT >(awaitable).operator co_await();
+		}
+		else if constexpr (requires { operator co_await(
+									 std::forward< AwaitableT >(awaitable)); })
+		{
+			return operator co_await(std::forward< AwaitableT >(awaitable));
+		}
+		else
+		{
+			return std::forward< AwaitableT >(awaitable);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// TimedPromise
+	//-------------------------------------------------------------------------
+
+	template< typename ClockT >
+	inline TimedPromise< ClockT >::TimedPromise() noexcept
+		: m_timer()
+	{
+		m_timer.Start();
+	}
+
+	template< typename ClockT >
+	template< typename AwaitableT >
+	[[nodiscard]]
+	inline TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >
+		TimedPromise< ClockT >::await_transform(AwaitableT&& awaitable)
+	{
+		return TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >(
+			GetAwaiter(std::forward< AwaitableT >(awaitable)), m_timer);
+	}
+
+	template< typename ClockT >
+	template< typename AwaitableT >
+	[[nodiscard]]
+	inline TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >
+		TimedPromise< ClockT >::TimedInitialSuspend(AwaitableT&& awaitable)
+	{
+		return await_transform(std::forward< AwaitableT >(awaitable));
+	}
+
+	template< typename ClockT >
+	template< typename AwaitableT >
+	[[nodiscard]]
+	inline TimedAwaiter< TimedAwaiterStorage< AwaitableT >, ClockT >
+		TimedPromise< ClockT >::TimedYield(AwaitableT&& awaitable)
+	{
+		return await_transform(std::forward< AwaitableT >(awaitable));
+	}
+
+	template< typename ClockT >
+	template< typename AwaitableT >
+	[[nodiscard]]
+	inline AwaitableT TimedPromise< ClockT >
+		::TimedFinalSuspend(AwaitableT&& awaitable) noexcept
+	{
+		m_timer.Stop();
+		return std::forward< AwaitableT >(awaitable);
+	}
+}
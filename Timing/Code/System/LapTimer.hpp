@@ -0,0 +1,333 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// F64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// array
+#include <array>
+// size_t
+#include <cstddef>
+// span
+#include <span>
+// string_view
+#include <string_view>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// LapLabel
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of compile-time lap labels (i.e. string literals usable as
+	 template arguments).
+
+	 @tparam		N
+					The number of characters (including the terminating null
+					character).
+	 */
+	template< std::size_t N >
+	struct LapLabel
+	{
+		/**
+		 Constructs a lap label from the given string literal.
+
+		 @param[in]		name
+						A reference to the string literal.
+		 */
+		consteval LapLabel(const char (&name)[N]) noexcept
+		{
+			for (std::size_t i = 0u; i < N; ++i)
+			{
+				m_name[i] = name[i];
+			}
+		}
+
+		/**
+		 The name of this lap label.
+		 */
+		char m_name[N] = {};
+	};
+
+	//-------------------------------------------------------------------------
+	// LapTimer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of lap timers with a fixed capacity.
+
+	 Recording a lap only reads the clock and stores the raw timestamp and a
+	 pointer to its (compile-time) label: no allocation, conversion or
+	 subtraction is performed. The laps are converted afterwards in a single
+	 pass to any time interval type.
+
+	 @tparam		ClockT
+					The clock type.
+	 @tparam		N
+					The maximum number of laps.
+	 */
+	template< typename ClockT, std::size_t N >
+	class LapTimer
+	{
+
+		static_assert(0u < N);
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time interval type of lap timers.
+		 */
+		using TimeInterval = typename ClockT::duration;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a lap timer.
+		 */
+		LapTimer() noexcept = default;
+
+		/**
+		 Constructs a lap timer from the given lap timer.
+
+		 @param[in]		timer
+						A reference to the lap timer to copy.
+		 */
+		LapTimer(const LapTimer& timer) noexcept = default;
+
+		/**
+		 Constructs a lap timer by moving the given lap timer.
+
+		 @param[in]		timer
+						A reference to the lap timer to move.
+		 */
+		LapTimer(LapTimer&& timer) noexcept = default;
+
+		/**
+		 Destructs this lap timer.
+		 */
+		~LapTimer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given lap timer to this lap timer.
+
+		 @param[in]		timer
+						A reference to the lap timer to copy.
+		 @return		A reference to the copy of the given lap timer (i.e.
+						this lap timer).
+		 */
+		LapTimer& operator=(const LapTimer& timer) noexcept = default;
+
+		/**
+		 Moves the given lap timer to this lap timer.
+
+		 @param[in]		timer
+						A reference to the lap timer to move.
+		 @return		A reference to the moved lap timer (i.e. this lap
+						timer).
+		 */
+		LapTimer& operator=(LapTimer&& timer) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts this lap timer (i.e. discards all laps).
+		 */
+		void Start() noexcept;
+
+		/**
+		 Records a lap with the given label.
+
+		 @tparam		LabelV
+						The label (e.g., @c Lap< "decode" >()).
+		 @return		@c true if the lap is recorded. @c false if this lap
+						timer is full.
+		 */
+		template< LapLabel LabelV >
+		bool Lap() noexcept;
+
+		/**
+		 Records a lap without label.
+
+		 @return		@c true if the lap is recorded. @c false if this lap
+						timer is full.
+		 */
+		bool Lap() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of recorded laps of this lap timer.
+
+		 @return		The number of recorded laps of this lap timer.
+		 */
+		[[nodiscard]]
+		std::size_t GetLapCount() const noexcept;
+
+		/**
+		 Returns the label of the lap at the given index of this lap timer.
+
+		 @param[in]		index
+						The lap index.
+		 @return		The label of the lap at the given index of this lap
+						timer (empty if the lap has no label).
+		 */
+		[[nodiscard]]
+		std::string_view GetLabel(std::size_t index) const noexcept;
+
+		/**
+		 Returns the duration (in ticks) of the lap at the given index of this
+		 lap timer.
+
+		 @param[in]		index
+						The lap index.
+		 @return		The duration of the lap at the given index of this lap
+						timer.
+		 */
+		[[nodiscard]]
+		TimeInterval GetLap(std::size_t index) const noexcept;
+
+		/**
+		 Converts the durations of the recorded laps of this lap timer to the
+		 given time interval type.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[out]	laps
+						The converted laps. The number of converted laps is
+						the minimum of the size of the given span and the
+						number of recorded laps.
+		 @return		The number of converted laps.
+		 */
+		template< typename TimeIntervalT >
+		std::size_t ConvertLaps(std::span< TimeIntervalT > laps) const noexcept;
+
+		/**
+		 Converts the split times (i.e. the times since the start) of the
+		 recorded laps of this lap timer to the given time interval type.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[out]	splits
+						The converted split times. The number of converted
+						split times is the minimum of the size of the given
+						span and the number of recorded laps.
+		 @return		The number of converted split times.
+		 */
+		template< typename TimeIntervalT >
+		std::size_t ConvertSplits(
+			std::span< TimeIntervalT > splits) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The representation type of the timestamps of lap timers.
+		 */
+		using Rep = typename ClockT::rep;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the conversion factor from ticks of the clock to (the
+		 representation of) the given time interval type.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		The conversion factor from ticks of the clock to the
+						given time interval type.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static F64 GetConversionFactor() noexcept;
+
+		/**
+		 Converts the given number of ticks to the given time interval type.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[in]		ticks
+						The number of ticks.
+		 @param[in]		factor
+						The conversion factor (see @c GetConversionFactor).
+		 @return		The converted time interval.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ConvertTicks(Rep ticks, F64 factor) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records a lap with the given label.
+
+		 @param[in]		label
+						A pointer to the null-terminated label (or
+						@c nullptr).
+		 @return		@c true if the lap is recorded. @c false if this lap
+						timer is full.
+		 */
+		bool Record(const char* label) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The clock of this lap timer.
+		 */
+		ClockT m_clock = {};
+
+		/**
+		 The start timestamp followed by the timestamps (in ticks) of the
+		 recorded laps of this lap timer.
+		 */
+		std::array< Rep, N + 1u > m_timestamps = {};
+
+		/**
+		 The labels of the recorded laps of this lap timer.
+		 */
+		std::array< const char*, N > m_labels = {};
+
+		/**
+		 The number of recorded laps of this lap timer.
+		 */
+		std::size_t m_lap_count = 0u;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/LapTimer.inl>
@@ -0,0 +1,166 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// min
+#include <algorithm>
+// duration
+#include <chrono>
+// ratio_divide
+#include <ratio>
+// is_same_v
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename ClockT, std::size_t N >
+	inline void LapTimer< ClockT, N >::Start() noexcept
+	{
+		m_lap_count     = 0u;
+		m_timestamps[0] = m_clock.now().time_since_epoch().count();
+	}
+
+	template< typename ClockT, std::size_t N >
+	template< LapLabel LabelV >
+	inline bool LapTimer< ClockT, N >::Lap() noexcept
+	{
+		return Record(LabelV.m_name);
+	}
+
+	template< typename ClockT, std::size_t N >
+	inline bool LapTimer< ClockT, N >::Lap() noexcept
+	{
+		return Record(nullptr);
+	}
+
+	template< typename ClockT, std::size_t N >
+	[[nodiscard]]
+	inline std::size_t LapTimer< ClockT, N >::GetLapCount() const noexcept
+	{
+		return m_lap_count;
+	}
+
+	template< typename ClockT, std::size_t N >
+	[[nodiscard]]
+	inline std::string_view LapTimer< ClockT, N >
+		::GetLabel(std::size_t index) const noexcept
+	{
+		return (nullptr != m_labels[index]) ? m_labels[index]
+											: std::string_view();
+	}
+
+	template< typename ClockT, std::size_t N >
+	[[nodiscard]]
+	inline auto LapTimer< ClockT, N >::GetLap(std::size_t index) const noexcept
+		-> TimeInterval
+	{
+		return TimeInterval(m_timestamps[index + 1u] - m_timestamps[index]);
+	}
+
+	template< typename ClockT, std::size_t N >
+	template< typename TimeIntervalT >
+	std::size_t LapTimer< ClockT, N >
+		::ConvertLaps(std::span< TimeIntervalT > laps) const noexcept
+	{
+		const auto count  = std::min(laps.size(), m_lap_count);
+		const auto factor = GetConversionFactor< TimeIntervalT >();
+		for (std::size_t i = 0u; i < count; ++i)
+		{
+			laps[i] = ConvertTicks< TimeIntervalT >(
+				m_timestamps[i + 1u] - m_timestamps[i], factor);
+		}
+
+		return count;
+	}
+
+	template< typename ClockT, std::size_t N >
+	template< typename TimeIntervalT >
+	std::size_t LapTimer< ClockT, N >
+		::ConvertSplits(std::span< TimeIntervalT > splits) const noexcept
+	{
+		const auto count  = std::min(splits.size(), m_lap_count);
+		const auto factor = GetConversionFactor< TimeIntervalT >();
+		const auto start  = m_timestamps[0];
+		for (std::size_t i = 0u; i < count; ++i)
+		{
+			splits[i] = ConvertTicks< TimeIntervalT >(
+				m_timestamps[i + 1u] - start, factor);
+		}
+
+		return count;
+	}
+
+	template< typename ClockT, std::size_t N >
+	template< typename TimeIntervalT >
+	[[nodiscard]]
+	inline F64 LapTimer< ClockT, N >::GetConversionFactor() noexcept
+	{
+		using OutputPeriod = typename TimeIntervalT::period;
+
+		constexpr bool has_conversion = requires (const TimeInterval& interval)
+		{
+			ClockT::template ToTimeInterval< std::chrono::duration< F64 > >(
+				interval);
+		};
+
+		if constexpr (std::is_same_v< TimeIntervalT, TimeInterval >)
+		{
+			return 1.0;
+		}
+		else if constexpr (has_conversion)
+		{
+			// Clocks whose period is only known at runtime (e.g., TscClock).
+			const auto seconds_per_tick = ClockT::template
+				ToTimeInterval< std::chrono::duration< F64 > >(
+					TimeInterval(Rep(1))).count();
+			return seconds_per_tick * static_cast< F64 >(OutputPeriod::den)
+									/ static_cast< F64 >(OutputPeriod::num);
+		}
+		else
+		{
+			using Ratio = std::ratio_divide< typename ClockT::period,
+											 OutputPeriod >;
+			return static_cast< F64 >(Ratio::num)
+				 / static_cast< F64 >(Ratio::den);
+		}
+	}
+
+	template< typename ClockT, std::size_t N >
+	template< typename TimeIntervalT >
+	[[nodiscard]]
+	inline TimeIntervalT LapTimer< ClockT, N >
+		::ConvertTicks(Rep ticks, F64 factor) noexcept
+	{
+		using OutputRep = typename TimeIntervalT::rep;
+
+		if constexpr (std::is_same_v< TimeIntervalT, TimeInterval >)
+		{
+			return TimeInterval(ticks);
+		}
+		else
+		{
+			return TimeIntervalT(static_cast< OutputRep >(
+				factor * static_cast< F64 >(ticks)));
+		}
+	}
+
+	template< typename ClockT, std::size_t N >
+	inline bool LapTimer< ClockT, N >::Record(const char* label) noexcept
+	{
+		if (N == m_lap_count)
+		{
+			return false;
+		}
+
+		m_timestamps[m_lap_count + 1u]
+			= m_clock.now().time_since_epoch().count();
+		m_labels[m_lap_count] = label;
+		++m_lap_count;
+		return true;
+	}
+}
@@ -0,0 +1,362 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// NowFenced
+#include <System/ClockCalibration.hpp>
+// CoreClockPerCore, ThreadCoreClock
+#include <System/SystemTime.hpp>
+// ConvertTimeInterval
+#include <System/Timer.hpp>
+// F64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// array
+#include <array>
+// duration, high_resolution_clock
+#include <chrono>
+// size_t
+#include <cstddef>
+// tuple
+#include <tuple>
+// index_sequence, pair
+#include <utility>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// MultiTimer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of timers sampling multiple clocks in lockstep.
+
+	 In contrast to multiple @c Timer instances, all clocks are sampled
+	 back to back with a single running flag. The clocks are read in order
+	 when starting and in reverse order when stopping, so the interval of
+	 each clock encloses the intervals of the clocks after it (e.g., a wall
+	 clock listed first encloses a CPU clock listed second).
+
+	 @tparam		ClockTs
+					The clock types.
+	 */
+	template< typename... ClockTs >
+	class MultiTimer
+	{
+
+		static_assert(0u < sizeof...(ClockTs));
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time interval types (i.e. a tuple of the duration type of each
+		 clock) of multi timers.
+		 */
+		using TimeIntervals = std::tuple< typename ClockTs::duration... >;
+
+		/**
+		 The converted time interval types of multi timers.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 */
+		template< typename TimeIntervalT >
+		using ConvertedTimeIntervals
+			= std::array< TimeIntervalT, sizeof...(ClockTs) >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a multi timer.
+		 */
+		MultiTimer() noexcept = default;
+
+		/**
+		 Constructs a multi timer from the given multi timer.
+
+		 @param[in]		timer
+						A reference to the multi timer to copy.
+		 */
+		MultiTimer(const MultiTimer& timer) noexcept = default;
+
+		/**
+		 Constructs a multi timer by moving the given multi timer.
+
+		 @param[in]		timer
+						A reference to the multi timer to move.
+		 */
+		MultiTimer(MultiTimer&& timer) noexcept = default;
+
+		/**
+		 Destructs this multi timer.
+		 */
+		~MultiTimer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given multi timer to this multi timer.
+
+		 @param[in]		timer
+						A reference to the multi timer to copy.
+		 @return		A reference to the copy of the given multi timer (i.e.
+						this multi timer).
+		 */
+		MultiTimer& operator=(const MultiTimer& timer) noexcept = default;
+
+		/**
+		 Moves the given multi timer to this multi timer.
+
+		 @param[in]		timer
+						A reference to the multi timer to move.
+		 @return		A reference to the moved multi timer (i.e. this multi
+						timer).
+		 */
+		MultiTimer& operator=(MultiTimer&& timer) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts this multi timer.
+		 */
+		void Start() noexcept;
+
+		/**
+		 Stops this multi timer.
+		 */
+		void Stop() noexcept;
+
+		/**
+		 Restarts this multi timer.
+		 */
+		void Restart() noexcept;
+
+		/**
+		 Resumes this multi timer.
+		 */
+		void Resume() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: (Total) Delta Time
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the delta times (in the duration type of each clock) of
+		 this multi timer.
+
+		 @return		The delta times of this multi timer.
+		 */
+		TimeIntervals DeltaTimes() noexcept;
+
+		/**
+		 Returns the delta times of this multi timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		The delta time of each clock of this multi timer (e.g.,
+						@c auto [wall, cpu] = timer.DeltaTime< T >()).
+		 */
+		template< typename TimeIntervalT >
+		ConvertedTimeIntervals< TimeIntervalT > DeltaTime() noexcept;
+
+		/**
+		 Returns the total delta times of this multi timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		The total delta time of each clock of this multi
+						timer.
+		 */
+		template< typename TimeIntervalT >
+		ConvertedTimeIntervals< TimeIntervalT > TotalDeltaTime() noexcept;
+
+		/**
+		 Returns the delta and total delta times of this multi timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		A pair containing the delta and total delta time of
+						each clock of this multi timer.
+		 */
+		template< typename TimeIntervalT >
+		std::pair< ConvertedTimeIntervals< TimeIntervalT >,
+				   ConvertedTimeIntervals< TimeIntervalT > > Time() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Derived Metrics
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the parallelism (i.e. the ratio of CPU time to wall clock
+		 time) of the last measured delta time (see @c DeltaTime) of this
+		 multi timer.
+
+		 @tparam		WallIndexV
+						The index of the wall clock.
+		 @tparam		CpuIndexV
+						The index of the CPU clock.
+		 @return		The parallelism of the delta time of this multi timer
+						(e.g., about 4 for four busy cores with a process
+						core clock such as @c CoreClock, or at most about 1
+						with a per-core clock such as @c CoreClockPerCore),
+						or zero if no wall clock time elapsed.
+		 */
+		template< std::size_t WallIndexV = 0u, std::size_t CpuIndexV = 1u >
+		[[nodiscard]]
+		F64 Parallelism() const noexcept;
+
+		/**
+		 Returns the off-CPU time (i.e. the wall clock time not spent on a
+		 CPU, such as blocking or waiting to be scheduled) of the last
+		 measured delta time (see @c DeltaTime) of this multi timer. This is
+		 meaningful for a thread core clock (or a single-threaded process).
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @tparam		WallIndexV
+						The index of the wall clock.
+		 @tparam		CpuIndexV
+						The index of the CPU clock.
+		 @return		The off-CPU time of the delta time of this multi timer
+						(clamped at zero).
+		 */
+		template< typename TimeIntervalT,
+				  std::size_t WallIndexV = 0u,
+				  std::size_t CpuIndexV  = 1u >
+		[[nodiscard]]
+		TimeIntervalT OffCpuTime() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time stamp types representing the time points of multi timers.
+		 */
+		using TimeStamps = std::tuple< typename ClockTs::time_point... >;
+
+		/**
+		 The index sequence of the clocks of multi timers.
+		 */
+		using Indices = std::index_sequence_for< ClockTs... >;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Resets the delta time, total delta time and last timestamps of this
+		 multi timer.
+		 */
+		void ResetDeltaTime() noexcept;
+
+		/**
+		 Updates the delta time, total delta time and last timestamps of this
+		 multi timer.
+		 */
+		void UpdateDeltaTime() noexcept;
+
+		/**
+		 Reads all clocks in order into the last timestamps of this multi
+		 timer.
+		 */
+		template< std::size_t... IndicesV >
+		void ReadClocks(std::index_sequence< IndicesV... >) noexcept;
+
+		/**
+		 Reads all clocks in reverse order and updates the delta times, total
+		 delta times and last timestamps of this multi timer.
+		 */
+		template< std::size_t... IndicesV >
+		void UpdateClocks(std::index_sequence< IndicesV... >) noexcept;
+
+		/**
+		 Converts the given time intervals to the given time interval type.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[in]		time_intervals
+						A reference to the time intervals to convert.
+		 @return		The converted time intervals.
+		 */
+		template< typename TimeIntervalT, std::size_t... IndicesV >
+		[[nodiscard]]
+		static ConvertedTimeIntervals< TimeIntervalT >
+			ConvertTimeIntervals(const TimeIntervals& time_intervals,
+								 std::index_sequence< IndicesV... >) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The clocks of this multi timer.
+		 */
+		std::tuple< ClockTs... > m_clocks = {};
+
+		/**
+		 The last timestamps of this multi timer.
+		 */
+		TimeStamps m_last_timestamps = {};
+
+		/**
+		 The delta times of this multi timer.
+		 */
+		TimeIntervals m_delta_times = {};
+
+		/**
+		 The total delta times of this multi timer.
+		 */
+		TimeIntervals m_total_delta_times = {};
+
+		/**
+		 Flag indicating whether this multi timer is running.
+		 */
+		bool m_running = false;
+	};
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of timers sampling the wall clock and the core clock per core
+	 in lockstep. The parallelism (see @c MultiTimer::Parallelism) of these
+	 timers is the utilization of the effective cores (i.e. at most about 1).
+	 */
+	using WallCpuTimer
+		= MultiTimer< std::chrono::high_resolution_clock, CoreClockPerCore >;
+
+	/**
+	 A class of timers sampling the wall clock and the thread core clock in
+	 lockstep (e.g., for measuring the off-CPU time of a thread).
+	 */
+	using WallThreadCpuTimer
+		= MultiTimer< std::chrono::high_resolution_clock, ThreadCoreClock >;
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/MultiTimer.inl>
@@ -0,0 +1,203 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename... ClockTs >
+	inline void MultiTimer< ClockTs... >::Start() noexcept
+	{
+		if (m_running)
+		{
+			return;
+		}
+
+		m_running = true;
+		ResetDeltaTime();
+	}
+
+	template< typename... ClockTs >
+	inline void MultiTimer< ClockTs... >::Stop() noexcept
+	{
+		if (!m_running)
+		{
+			return;
+		}
+
+		m_running = false;
+		UpdateDeltaTime();
+	}
+
+	template< typename... ClockTs >
+	inline void MultiTimer< ClockTs... >::Restart() noexcept
+	{
+		m_running = false;
+		Start();
+	}
+
+	template< typename... ClockTs >
+	inline void MultiTimer< ClockTs... >::Resume() noexcept
+	{
+		if (m_running)
+		{
+			return;
+		}
+
+		m_running = true;
+		ReadClocks(Indices());
+	}
+
+	template< typename... ClockTs >
+	inline auto MultiTimer< ClockTs... >::DeltaTimes() noexcept
+		-> TimeIntervals
+	{
+		if (m_running)
+		{
+			UpdateDeltaTime();
+		}
+
+		return m_delta_times;
+	}
+
+	template< typename... ClockTs >
+	template< typename TimeIntervalT >
+	inline auto MultiTimer< ClockTs... >::DeltaTime() noexcept
+		-> ConvertedTimeIntervals< TimeIntervalT >
+	{
+		if (m_running)
+		{
+			UpdateDeltaTime();
+		}
+
+		return ConvertTimeIntervals< TimeIntervalT >(m_delta_times,
+													 Indices());
+	}
+
+	template< typename... ClockTs >
+	template< typename TimeIntervalT >
+	inline auto MultiTimer< ClockTs... >::TotalDeltaTime() noexcept
+		-> ConvertedTimeIntervals< TimeIntervalT >
+	{
+		if (m_running)
+		{
+			UpdateDeltaTime();
+		}
+
+		return ConvertTimeIntervals< TimeIntervalT >(m_total_delta_times,
+													 Indices());
+	}
+
+	template< typename... ClockTs >
+	template< typename TimeIntervalT >
+	inline auto MultiTimer< ClockTs... >::Time() noexcept
+		-> std::pair< ConvertedTimeIntervals< TimeIntervalT >,
+					  ConvertedTimeIntervals< TimeIntervalT > >
+	{
+		if (m_running)
+		{
+			UpdateDeltaTime();
+		}
+
+		return
+		{
+			ConvertTimeIntervals< TimeIntervalT >(m_delta_times, Indices()),
+			ConvertTimeIntervals< TimeIntervalT >(m_total_delta_times,
+												  Indices())
+		};
+	}
+
+	template< typename... ClockTs >
+	template< std::size_t WallIndexV, std::size_t CpuIndexV >
+	[[nodiscard]]
+	inline F64 MultiTimer< ClockTs... >::Parallelism() const noexcept
+	{
+		using TimeInterval = std::chrono::duration< F64 >;
+
+		const auto time_intervals
+			= ConvertTimeIntervals< TimeInterval >(m_delta_times, Indices());
+		const auto wall = std::get< WallIndexV >(time_intervals);
+		const auto cpu  = std::get< CpuIndexV >(time_intervals);
+		return (TimeInterval::zero() < wall) ? cpu / wall : 0.0;
+	}
+
+	template< typename... ClockTs >
+	template< typename TimeIntervalT,
+			  std::size_t WallIndexV, std::size_t CpuIndexV >
+	[[nodiscard]]
+	inline TimeIntervalT MultiTimer< ClockTs... >::OffCpuTime() const noexcept
+	{
+		const auto time_intervals
+			= ConvertTimeIntervals< TimeIntervalT >(m_delta_times, Indices());
+		const auto wall = std::get< WallIndexV >(time_intervals);
+		const auto cpu  = std::get< CpuIndexV >(time_intervals);
+		return (cpu < wall) ? wall - cpu : TimeIntervalT::zero();
+	}
+
+	template< typename... ClockTs >
+	inline void MultiTimer< ClockTs... >::ResetDeltaTime() noexcept
+	{
+		// Resets the delta times of this multi timer.
+		m_delta_times = {};
+		// Resets the total delta times of this multi timer.
+		m_total_delta_times = {};
+		// Resets the last timestamps of this multi timer.
+		ReadClocks(Indices());
+	}
+
+	template< typename... ClockTs >
+	inline void MultiTimer< ClockTs... >::UpdateDeltaTime() noexcept
+	{
+		UpdateClocks(Indices());
+	}
+
+	template< typename... ClockTs >
+	template< std::size_t... IndicesV >
+	inline void MultiTimer< ClockTs... >
+		::ReadClocks(std::index_sequence< IndicesV... >) noexcept
+	{
+		// The comma fold reads the clocks from first to last.
+		((std::get< IndicesV >(m_last_timestamps)
+		  = std::get< IndicesV >(m_clocks).now()), ...);
+	}
+
+	template< typename... ClockTs >
+	template< std::size_t... IndicesV >
+	inline void MultiTimer< ClockTs... >
+		::UpdateClocks(std::index_sequence< IndicesV... >) noexcept
+	{
+		constexpr auto last = sizeof...(ClockTs) - 1u;
+
+		// Get the current timestamps (from last to first) of this multi
+		// timer. As for Timer, the reads ending the measured intervals are
+		// fenced.
+		TimeStamps current_timestamps;
+		((std::get< last - IndicesV >(current_timestamps)
+		  = NowFenced(std::get< last - IndicesV >(m_clocks))), ...);
+
+		// Updates the delta times and total delta times of this multi timer.
+		((std::get< IndicesV >(m_delta_times)
+		  = std::get< IndicesV >(current_timestamps)
+		  - std::get< IndicesV >(m_last_timestamps)), ...);
+		((std::get< IndicesV >(m_total_delta_times)
+		  += std::get< IndicesV >(m_delta_times)), ...);
+
+		// Updates the last timestamps of this multi timer.
+		m_last_timestamps = current_timestamps;
+	}
+
+	template< typename... ClockTs >
+	template< typename TimeIntervalT, std::size_t... IndicesV >
+	[[nodiscard]]
+	inline auto MultiTimer< ClockTs... >::ConvertTimeIntervals(
+		const TimeIntervals& time_intervals,
+		std::index_sequence< IndicesV... >) noexcept
+		-> ConvertedTimeIntervals< TimeIntervalT >
+	{
+		return
+		{
+			ConvertTimeInterval< ClockTs, TimeIntervalT >(
+				std::get< IndicesV >(time_intervals))...
+		};
+	}
+}
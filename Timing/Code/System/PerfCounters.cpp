@@ -0,0 +1,307 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <System/PerfCounters.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+#ifdef __linux__
+
+// size
+#include <iterator>
+// perf_event_attr, PERF_*
+#include <linux/perf_event.h>
+// ioctl
+#include <sys/ioctl.h>
+// syscall, SYS_perf_event_open
+#include <sys/syscall.h>
+// close, read
+#include <unistd.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 Returns the ratio of the given numerator to the given denominator
+		 scaled by the given factor.
+
+		 @param[in]		numerator
+						The numerator.
+		 @param[in]		denominator
+						The denominator.
+		 @param[in]		scale
+						The scale factor.
+		 @return		The scaled ratio, or zero if the denominator is zero.
+		 */
+		[[nodiscard]]
+		F64 Ratio(U64 numerator, U64 denominator, F64 scale) noexcept
+		{
+			return (0u == denominator) ? 0.0
+				 : scale * static_cast< F64 >(numerator)
+						 / static_cast< F64 >(denominator);
+		}
+
+#ifdef __linux__
+
+		/**
+		 A struct of descriptions of performance counters.
+		 */
+		struct PerfCounterDescription
+		{
+			/**
+			 The perf event type of this performance counter description.
+			 */
+			U32 m_type;
+
+			/**
+			 The perf event config of this performance counter description.
+			 */
+			U64 m_config;
+		};
+
+		/**
+		 The descriptions of the performance counters (in the order of
+		 @c PerfCounter).
+		 */
+		constexpr PerfCounterDescription g_descriptions[] =
+		{
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES          },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS        },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES        },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES       },
+			{ PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK          },
+			{ PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES    },
+			{ PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS         }
+		};
+
+		static_assert(std::size(g_descriptions) == PerfCounters::s_count);
+
+		/**
+		 Opens a performance counter for the calling thread.
+
+		 @param[in]		description
+						A reference to the performance counter description.
+		 @param[in]		group_fd
+						The file descriptor of the group leader, or -1 to
+						open a group leader.
+		 @param[in]		exclude_kernel
+						@c true to exclude events in kernel mode. @c false
+						otherwise.
+		 @return		The file descriptor of the performance counter, or -1
+						on failure.
+		 */
+		[[nodiscard]]
+		int OpenPerfCounter(const PerfCounterDescription& description,
+							int group_fd,
+							bool exclude_kernel) noexcept
+		{
+			perf_event_attr attributes = {};
+			attributes.size           = sizeof(attributes);
+			attributes.type           = description.m_type;
+			attributes.config         = description.m_config;
+			attributes.disabled       = (-1 == group_fd) ? 1u : 0u;
+			attributes.exclude_kernel = exclude_kernel ? 1u : 0u;
+			attributes.exclude_hv     = 1u;
+			attributes.read_format    = PERF_FORMAT_GROUP
+									  | PERF_FORMAT_TOTAL_TIME_ENABLED
+									  | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			// pid = 0 and cpu = -1: the calling thread on any core.
+			return static_cast< int >(::syscall(SYS_perf_event_open,
+												&attributes, 0, -1, group_fd,
+												PERF_FLAG_FD_CLOEXEC));
+		}
+
+		/**
+		 Opens a performance counter for the calling thread. Kernel mode
+		 events are included if permitted (e.g., context switches are only
+		 observed in kernel mode).
+
+		 @param[in]		description
+						A reference to the performance counter description.
+		 @param[in]		group_fd
+						The file descriptor of the group leader, or -1 to
+						open a group leader.
+		 @return		The file descriptor of the performance counter, or -1
+						on failure.
+		 */
+		[[nodiscard]]
+		int OpenPerfCounter(const PerfCounterDescription& description,
+							int group_fd) noexcept
+		{
+			const auto fd = OpenPerfCounter(description, group_fd, false);
+			return (-1 != fd) ? fd
+							  : OpenPerfCounter(description, group_fd, true);
+		}
+
+#endif
+	}
+
+	//-------------------------------------------------------------------------
+	// PerfCounters
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	F64 PerfCounters::GetInstructionsPerCycle() const noexcept
+	{
+		return Ratio((*this)[PerfCounter::Instructions],
+					 (*this)[PerfCounter::Cycles], 1.0);
+	}
+
+	[[nodiscard]]
+	F64 PerfCounters::GetCacheMissesPerKiloInstruction() const noexcept
+	{
+		return Ratio((*this)[PerfCounter::CacheMisses],
+					 (*this)[PerfCounter::Instructions], 1000.0);
+	}
+
+	[[nodiscard]]
+	F64 PerfCounters::GetBranchMissesPerKiloInstruction() const noexcept
+	{
+		return Ratio((*this)[PerfCounter::BranchMisses],
+					 (*this)[PerfCounter::Instructions], 1000.0);
+	}
+
+	//-------------------------------------------------------------------------
+	// PerfCounterGroup
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	PerfCounterGroup& PerfCounterGroup::Get() noexcept
+	{
+		thread_local PerfCounterGroup s_group;
+		return s_group;
+	}
+
+	PerfCounterGroup::PerfCounterGroup() noexcept
+		: m_fds{},
+		m_fd_count(0u),
+		m_indices{},
+		m_last_raw_counts(),
+		m_last_time_enabled(0u),
+		m_last_time_running(0u),
+		m_counts()
+	{
+		m_fds.fill(-1);
+		m_indices.fill(s_unavailable);
+
+#ifdef __linux__
+
+		// The task clock leads the group: software counters are available
+		// without a performance monitoring unit.
+		const auto leader = static_cast< std::size_t >(PerfCounter::TaskClock);
+		const auto leader_fd = OpenPerfCounter(g_descriptions[leader], -1);
+		if (-1 == leader_fd)
+		{
+			return;
+		}
+
+		m_fds[m_fd_count]  = leader_fd;
+		m_indices[leader]  = m_fd_count++;
+
+		for (std::size_t i = 0u; i < PerfCounters::s_count; ++i)
+		{
+			if (leader == i)
+			{
+				continue;
+			}
+
+			const auto fd = OpenPerfCounter(g_descriptions[i], leader_fd);
+			if (-1 == fd)
+			{
+				continue;
+			}
+
+			m_fds[m_fd_count] = fd;
+			m_indices[i]      = m_fd_count++;
+		}
+
+		::ioctl(leader_fd, PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+		::ioctl(leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+#endif
+	}
+
+	PerfCounterGroup::~PerfCounterGroup()
+	{
+#ifdef __linux__
+
+		// Closes the group members before the group leader.
+		for (auto i = m_fd_count; 0u != i; --i)
+		{
+			::close(m_fds[i - 1u]);
+		}
+
+#endif
+	}
+
+	[[nodiscard]]
+	bool PerfCounterGroup::IsAvailable(PerfCounter counter) const noexcept
+	{
+		return s_unavailable != m_indices[static_cast< std::size_t >(counter)];
+	}
+
+	[[nodiscard]]
+	PerfCounters PerfCounterGroup::Read() noexcept
+	{
+#ifdef __linux__
+
+		if (0u == m_fd_count)
+		{
+			return m_counts;
+		}
+
+		// PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+		// | PERF_FORMAT_TOTAL_TIME_RUNNING layout:
+		// { nr, time_enabled, time_running, values[nr] }
+		U64 buffer[3u + PerfCounters::s_count];
+		const auto size = static_cast< std::size_t >(
+			(3u + m_fd_count) * sizeof(U64));
+		if (static_cast< ::ssize_t >(size)
+			!= ::read(m_fds[0], buffer, size))
+		{
+			return m_counts;
+		}
+
+		// Extrapolates the increase since the previous read if the group was
+		// multiplexed in between. Scaling the cumulative counts instead would
+		// not be monotonic when the ratio changes.
+		const auto delta_enabled = buffer[1] - m_last_time_enabled;
+		const auto delta_running = buffer[2] - m_last_time_running;
+		const auto scale
+			= (0u != delta_running && delta_running < delta_enabled)
+			? static_cast< F64 >(delta_enabled)
+			/ static_cast< F64 >(delta_running) : 1.0;
+		m_last_time_enabled = buffer[1];
+		m_last_time_running = buffer[2];
+
+		for (std::size_t i = 0u; i < PerfCounters::s_count; ++i)
+		{
+			const auto index = m_indices[i];
+			if (s_unavailable == index)
+			{
+				continue;
+			}
+
+			const auto value = buffer[3u + index];
+			const auto delta = value - m_last_raw_counts.m_values[i];
+			m_last_raw_counts.m_values[i] = value;
+			m_counts.m_values[i] += (1.0 == scale) ? delta
+				: static_cast< U64 >(scale * static_cast< F64 >(delta));
+		}
+
+#endif
+
+		return m_counts;
+	}
+}
@@ -0,0 +1,538 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Timer
+#include <System/Timer.hpp>
+// F64, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// array
+#include <array>
+// duration, time_point
+#include <chrono>
+// size_t
+#include <cstddef>
+// ratio
+#include <ratio>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// PerfCounter
+	//-------------------------------------------------------------------------
+
+	/**
+	 An enumeration of the different performance counters.
+	 */
+	enum class PerfCounter : std::size_t
+	{
+		// Hardware counters
+		Cycles = 0,
+		Instructions,
+		CacheMisses,
+		BranchMisses,
+		// Software counters
+		TaskClock,
+		ContextSwitches,
+		PageFaults,
+		// Number of performance counters
+		Count
+	};
+
+	//-------------------------------------------------------------------------
+	// PerfCounters
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of performance counter values.
+	 */
+	struct PerfCounters
+	{
+		/**
+		 The number of performance counters.
+		 */
+		static constexpr std::size_t s_count
+			= static_cast< std::size_t >(PerfCounter::Count);
+
+		/**
+		 Returns zero performance counters.
+
+		 @return		Zero performance counters.
+		 */
+		[[nodiscard]]
+		static constexpr PerfCounters zero() noexcept
+		{
+			return {};
+		}
+
+		/**
+		 Adds the given performance counters to these performance counters.
+
+		 @param[in]		counters
+						A reference to the performance counters to add.
+		 @return		A reference to the sum of the given performance
+						counters and these performance counters (i.e. these
+						performance counters).
+		 */
+		constexpr PerfCounters& operator+=(
+			const PerfCounters& counters) noexcept
+		{
+			for (std::size_t i = 0u; i < s_count; ++i)
+			{
+				m_values[i] += counters.m_values[i];
+			}
+
+			return *this;
+		}
+
+		/**
+		 Returns the value of the given performance counter of these
+		 performance counters.
+
+		 @param[in]		counter
+						The performance counter.
+		 @return		The value of the given performance counter of these
+						performance counters.
+		 */
+		[[nodiscard]]
+		constexpr U64 operator[](PerfCounter counter) const noexcept
+		{
+			return m_values[static_cast< std::size_t >(counter)];
+		}
+
+		/**
+		 Returns the value of the given performance counter of these
+		 performance counters.
+
+		 @param[in]		counter
+						The performance counter.
+		 @return		A reference to the value of the given performance
+						counter of these performance counters.
+		 */
+		[[nodiscard]]
+		constexpr U64& operator[](PerfCounter counter) noexcept
+		{
+			return m_values[static_cast< std::size_t >(counter)];
+		}
+
+		/**
+		 Returns the number of instructions per cycle (IPC) of these
+		 performance counters.
+
+		 @return		The number of instructions per cycle of these
+						performance counters, or zero if no cycles were
+						counted.
+		 */
+		[[nodiscard]]
+		F64 GetInstructionsPerCycle() const noexcept;
+
+		/**
+		 Returns the number of cache misses per thousand instructions (MPKI)
+		 of these performance counters.
+
+		 @return		The number of cache misses per thousand instructions
+						of these performance counters, or zero if no
+						instructions were counted.
+		 */
+		[[nodiscard]]
+		F64 GetCacheMissesPerKiloInstruction() const noexcept;
+
+		/**
+		 Returns the number of branch misses per thousand instructions of
+		 these performance counters.
+
+		 @return		The number of branch misses per thousand instructions
+						of these performance counters, or zero if no
+						instructions were counted.
+		 */
+		[[nodiscard]]
+		F64 GetBranchMissesPerKiloInstruction() const noexcept;
+
+		/**
+		 The values of these performance counters.
+		 */
+		std::array< U64, s_count > m_values = {};
+	};
+
+	//-------------------------------------------------------------------------
+	// PerfCounterGroup
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of performance counter groups of the calling thread.
+
+	 All performance counters are opened (with Linux @c perf_event_open) as a
+	 single group which is read atomically with a single @c read (i.e.
+	 @c PERF_FORMAT_GROUP). The software counters are always opened; the
+	 hardware counters are added if the processor exposes a performance
+	 monitoring unit and the system permits access (e.g., not in most
+	 virtual machines). Unavailable counters read as zero.
+
+	 @note			The performance counters are unavailable on platforms
+					other than Linux.
+	 */
+	class PerfCounterGroup
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the performance counter group of the calling thread.
+
+		 @return		A reference to the performance counter group of the
+						calling thread.
+		 */
+		[[nodiscard]]
+		static PerfCounterGroup& Get() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a performance counter group from the given performance
+		 counter group.
+
+		 @param[in]		group
+						A reference to the performance counter group to copy.
+		 */
+		PerfCounterGroup(const PerfCounterGroup& group) = delete;
+
+		/**
+		 Constructs a performance counter group by moving the given
+		 performance counter group.
+
+		 @param[in]		group
+						A reference to the performance counter group to move.
+		 */
+		PerfCounterGroup(PerfCounterGroup&& group) = delete;
+
+		/**
+		 Destructs this performance counter group.
+		 */
+		~PerfCounterGroup();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given performance counter group to this performance
+		 counter group.
+
+		 @param[in]		group
+						A reference to the performance counter group to copy.
+		 @return		A reference to the copy of the given performance
+						counter group (i.e. this performance counter group).
+		 */
+		PerfCounterGroup& operator=(const PerfCounterGroup& group) = delete;
+
+		/**
+		 Moves the given performance counter group to this performance
+		 counter group.
+
+		 @param[in]		group
+						A reference to the performance counter group to move.
+		 @return		A reference to the moved performance counter group
+						(i.e. this performance counter group).
+		 */
+		PerfCounterGroup& operator=(PerfCounterGroup&& group) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the given performance counter of this performance
+		 counter group is available.
+
+		 @param[in]		counter
+						The performance counter.
+		 @return		@c true if the given performance counter of this
+						performance counter group is available. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsAvailable(PerfCounter counter) const noexcept;
+
+		/**
+		 Reads the performance counters of this performance counter group.
+
+		 If the group was multiplexed, the increase of the raw counts since
+		 the previous read is extrapolated by the ratio of the increase of the
+		 enabled time to the increase of the running time of that interval.
+		 The extrapolated counts are accumulated, so they never decrease and
+		 any two reads can be subtracted.
+
+		 @return		The (extrapolated) performance counters of this
+						performance counter group.
+		 */
+		[[nodiscard]]
+		PerfCounters Read() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a performance counter group for the calling thread.
+		 */
+		PerfCounterGroup() noexcept;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of unavailable performance counters.
+		 */
+		static constexpr std::size_t s_unavailable = PerfCounters::s_count;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The file descriptors of the opened performance counters of this
+		 performance counter group (in group order).
+		 */
+		std::array< int, PerfCounters::s_count > m_fds;
+
+		/**
+		 The number of opened performance counters of this performance
+		 counter group.
+		 */
+		std::size_t m_fd_count;
+
+		/**
+		 The group indices of the performance counters of this performance
+		 counter group.
+		 */
+		std::array< std::size_t, PerfCounters::s_count > m_indices;
+
+		/**
+		 The raw counts of the previous read of this performance counter
+		 group.
+		 */
+		PerfCounters m_last_raw_counts;
+
+		/**
+		 The time enabled (in nanoseconds) of the previous read of this
+		 performance counter group.
+		 */
+		U64 m_last_time_enabled;
+
+		/**
+		 The time running (in nanoseconds) of the previous read of this
+		 performance counter group.
+		 */
+		U64 m_last_time_running;
+
+		/**
+		 The accumulated extrapolated counts of this performance counter
+		 group.
+		 */
+		PerfCounters m_counts;
+	};
+
+	//-------------------------------------------------------------------------
+	// PerfCounterClock
+	//-------------------------------------------------------------------------
+
+	/**
+	 A "clock" of a performance counter of the calling thread, to be used
+	 with @c Timer (e.g., @c Timer< CycleCounterClock >).
+
+	 The durations of this clock are expressed in raw counts (e.g., cycles,
+	 instructions, nanoseconds for @c PerfCounter::TaskClock) and can only be
+	 retrieved as @c duration. Timers of this clock must be started and
+	 stopped on the same thread.
+
+	 @tparam		CounterV
+					The performance counter.
+	 */
+	template< PerfCounter CounterV >
+	struct PerfCounterClock
+	{
+		using rep        = U64;
+		using period     = std::ratio< 1 >;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< PerfCounterClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+
+		/**
+		 Converts the given duration (in counts) to a time interval.
+
+		 @tparam		TimeIntervalT
+						The time interval type (must be @c duration).
+		 @param[in]		time_interval
+						The duration (in counts).
+		 @return		The given duration.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(duration time_interval) noexcept;
+	};
+
+	/**
+	 A clock of the number of cycles of the calling thread.
+	 */
+	using CycleCounterClock = PerfCounterClock< PerfCounter::Cycles >;
+
+	/**
+	 A clock of the number of retired instructions of the calling thread.
+	 */
+	using InstructionCounterClock
+		= PerfCounterClock< PerfCounter::Instructions >;
+
+	/**
+	 A clock of the number of last-level cache misses of the calling thread.
+	 */
+	using CacheMissCounterClock = PerfCounterClock< PerfCounter::CacheMisses >;
+
+	/**
+	 A clock of the number of branch misses of the calling thread.
+	 */
+	using BranchMissCounterClock
+		= PerfCounterClock< PerfCounter::BranchMisses >;
+
+	/**
+	 A clock of the task clock (in nanoseconds) of the calling thread.
+	 */
+	using TaskCounterClock = PerfCounterClock< PerfCounter::TaskClock >;
+
+	/**
+	 A clock of the number of context switches of the calling thread.
+	 */
+	using ContextSwitchCounterClock
+		= PerfCounterClock< PerfCounter::ContextSwitches >;
+
+	/**
+	 A clock of the number of page faults of the calling thread.
+	 */
+	using PageFaultCounterClock = PerfCounterClock< PerfCounter::PageFaults >;
+
+	//-------------------------------------------------------------------------
+	// PerfCountersClock
+	//-------------------------------------------------------------------------
+
+	/**
+	 A "clock" of all performance counters of the calling thread, to be used
+	 with @c Timer (i.e. @c PerfCounterTimer).
+
+	 The durations of this clock are performance counters and can only be
+	 retrieved as @c duration. Timers of this clock must be started and
+	 stopped on the same thread.
+	 */
+	struct PerfCountersClock
+	{
+		using rep        = U64;
+		using period     = std::ratio< 1 >;
+		using duration   = PerfCounters;
+
+		/**
+		 A snapshot of all performance counters.
+		 */
+		struct time_point
+		{
+			/**
+			 Returns the smallest snapshot.
+
+			 @return		The smallest snapshot (i.e. all zero).
+			 */
+			[[nodiscard]]
+			static constexpr time_point min() noexcept
+			{
+				return {};
+			}
+
+			/**
+			 Returns the performance counters between the given snapshots.
+
+			 @param[in]		lhs
+							A reference to the later snapshot.
+			 @param[in]		rhs
+							A reference to the earlier snapshot.
+			 @return		The performance counters between the given
+							snapshots.
+			 */
+			[[nodiscard]]
+			friend constexpr duration operator-(const time_point& lhs,
+												const time_point& rhs) noexcept
+			{
+				duration counters;
+				for (std::size_t i = 0u; i < PerfCounters::s_count; ++i)
+				{
+					counters.m_values[i] = lhs.m_counters.m_values[i]
+										 - rhs.m_counters.m_values[i];
+				}
+
+				return counters;
+			}
+
+			/**
+			 The performance counters of this snapshot.
+			 */
+			PerfCounters m_counters;
+		};
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+
+		/**
+		 Converts the given performance counters to a time interval.
+
+		 @tparam		TimeIntervalT
+						The time interval type (must be @c duration).
+		 @param[in]		time_interval
+						A reference to the performance counters.
+		 @return		The given performance counters.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(
+			const duration& time_interval) noexcept;
+	};
+
+	//-------------------------------------------------------------------------
+	// PerfCounterTimer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of performance counter timers.
+
+	 In contrast to a @c Timer per @c PerfCounterClock, all performance
+	 counters are read together (i.e. with a single @c read per timestamp),
+	 resulting in consistent ratios (e.g., instructions per cycle). Timers
+	 must be started and stopped on the same thread. The time interval type
+	 is @c PerfCounters (e.g., @c DeltaTime< PerfCounters >).
+	 */
+	using PerfCounterTimer = Timer< PerfCountersClock >;
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/PerfCounters.inl>
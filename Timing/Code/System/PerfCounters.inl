@@ -0,0 +1,60 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// is_same_v
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// PerfCounterClock
+	//-------------------------------------------------------------------------
+
+	template< PerfCounter CounterV >
+	[[nodiscard]]
+	inline typename PerfCounterClock< CounterV >::time_point
+		PerfCounterClock< CounterV >::now() noexcept
+	{
+		const auto counters = PerfCounterGroup::Get().Read();
+		return time_point(duration(counters[CounterV]));
+	}
+
+	template< PerfCounter CounterV >
+	template< typename TimeIntervalT >
+	[[nodiscard]]
+	inline TimeIntervalT PerfCounterClock< CounterV >
+		::ToTimeInterval(duration time_interval) noexcept
+	{
+		static_assert(std::is_same_v< TimeIntervalT, duration >,
+					  "Counts cannot be converted to other time intervals.");
+
+		return time_interval;
+	}
+
+	//-------------------------------------------------------------------------
+	// PerfCountersClock
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	inline auto PerfCountersClock::now() noexcept -> time_point
+	{
+		return { PerfCounterGroup::Get().Read() };
+	}
+
+	template< typename TimeIntervalT >
+	[[nodiscard]]
+	inline TimeIntervalT PerfCountersClock
+		::ToTimeInterval(const duration& time_interval) noexcept
+	{
+		static_assert(std::is_same_v< TimeIntervalT, duration >,
+					  "Counts cannot be converted to other time intervals.");
+
+		return time_interval;
+	}
+}
@@ -4,21 +4,35 @@
 
 // Declarations
 #include <System/SystemTime.hpp>
-// FileTimeToLocalFileTime, GetProcessTimes, GetSystemInfo,
-// GetSystemTimeAsFileTime
+
+#ifdef _WIN32
+
+// GetProcessTimes, GetSystemTimeAsFileTime, GetThreadTimes
 #include <System/Windows.hpp>
+// GetProcessMemoryInfo, PROCESS_MEMORY_COUNTERS
+#include <psapi.h>
+
+#endif
 
 //-----------------------------------------------------------------------------
 // External Includes
 //-----------------------------------------------------------------------------
 
-// size_t
-#include <cstddef>
-// size
-#include <iterator>
 // pair
 #include <utility>
 
+#ifndef _WIN32
+
+// getrusage, rusage, RUSAGE_SELF, RUSAGE_THREAD
+#include <sys/resource.h>
+// timeval
+#include <sys/time.h>
+// clock_gettime, timespec, CLOCK_MONOTONIC, CLOCK_PROCESS_CPUTIME_ID,
+// CLOCK_THREAD_CPUTIME_ID
+#include <time.h>
+
+#endif
+
 //-----------------------------------------------------------------------------
 // Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -29,6 +43,8 @@ namespace mage
 	//-------------------------------------------------------------------------
 	namespace
 	{
+#ifdef _WIN32
+
 		[[nodiscard]]
 		inline FILETIME FileTime() noexcept
 		{
@@ -39,41 +55,106 @@ namespace mage
 			return file_time;
 		}
 
+		/**
+		 Converts the given file time to an @c U64 (in 100 ns).
+
+		 @param[in]		file_time
+						A reference to the file time.
+		 @return		A @c U64 (in 100 ns) representing the given file time.
+		 */
+		[[nodiscard]]
+		inline U64 ConvertTimestamp(const FILETIME& file_time) noexcept
+		{
+			return (U64(file_time.dwHighDateTime) << 32u)
+				  | U64(file_time.dwLowDateTime);
+		}
+
+		/**
+		 Returns the current system timestamp (in 100 ns).
+
+		 @return		The current system timestamp.
+		 */
+		[[nodiscard]]
+		inline U64 SystemTimestamp() noexcept
+		{
+			// Intervals do not depend on the time zone: the conversion to
+			// local time is omitted to avoid its cost on every sample.
+			return ConvertTimestamp(FileTime());
+		}
+
+#else
+
+		/**
+		 Converts the given time specification to an @c U64 (in 1 ns).
+
+		 @param[in]		time
+						A reference to the time specification.
+		 @return		A @c U64 (in 1 ns) representing the given time
+						specification.
+		 */
+		[[nodiscard]]
+		inline U64 ConvertTimestamp(const timespec& time) noexcept
+		{
+			return U64(time.tv_sec) * 1'000'000'000u + U64(time.tv_nsec);
+		}
+
+		/**
+		 Converts the given time value to an @c U64 (in 1 ns).
+
+		 @param[in]		time
+						A reference to the time value.
+		 @return		A @c U64 (in 1 ns) representing the given time value.
+		 */
 		[[nodiscard]]
-		inline FILETIME LocalFileTime() noexcept
+		inline U64 ConvertTimestamp(const timeval& time) noexcept
 		{
-			const auto file_time = FileTime();
-			FILETIME local_file_time;
-			if (FALSE == 
-				::FileTimeToLocalFileTime(&file_time, &local_file_time))
+			return U64(time.tv_sec) * 1'000'000'000u
+				 + U64(time.tv_usec) * 1'000u;
+		}
+
+		/**
+		 Returns the current timestamp (in 1 ns) of the given clock.
+
+		 @param[in]		clock_id
+						The clock identifier.
+		 @return		The current timestamp of the given clock.
+		 @note			If the retrieval fails, the timestamp is zero. To get
+						extended error information, check @c errno.
+		 */
+		[[nodiscard]]
+		inline U64 ClockTimestamp(clockid_t clock_id) noexcept
+		{
+			timespec time;
+			if (0 != ::clock_gettime(clock_id, &time))
 			{
 				return {};
 			}
 			else
 			{
-				return local_file_time;
+				return ConvertTimestamp(time);
 			}
 		}
-		
+
 		/**
-		 Converts the given file time to an @c U64 (in 100 ns).
+		 Returns the current system timestamp (in 1 ns).
 
-		 @param[in]		file_time
-						A reference to the file time.
-		 @return		A @c U64 (in 100 ns) representing the given file time.
+		 @return		The current system timestamp.
 		 */
 		[[nodiscard]]
-		inline U64 ConvertTimestamp(const FILETIME& file_time) noexcept
+		inline U64 SystemTimestamp() noexcept
 		{
-			return (U64(file_time.dwHighDateTime) << 32u) 
-				  | U64(file_time.dwLowDateTime);
+			// CLOCK_MONOTONIC is served from the vDSO (i.e. without a system
+			// call).
+			return ClockTimestamp(CLOCK_MONOTONIC);
 		}
+
+#endif
 	}
 
 	[[nodiscard]]
 	auto SystemClock::now() noexcept -> time_point
 	{
-		return time_point(duration(ConvertTimestamp(LocalFileTime())));
+		return time_point(duration(SystemTimestamp()));
 	}
 
 	//-------------------------------------------------------------------------
@@ -81,21 +162,8 @@ namespace mage
 	//-------------------------------------------------------------------------
 	namespace
 	{
-		/**
-		 Returns the number of system cores (i.e. logical processors).
+#ifdef _WIN32
 
-		 @return		The number of system cores (i.e. logical processors).
-		 */
-		[[nodiscard]]
-		std::size_t NumberOfSystemCores() noexcept
-		{
-			SYSTEM_INFO system_info = {};
-			::GetSystemInfo(&system_info);
-			
-			// Return the number of logical processors in the current group.
-			return system_info.dwNumberOfProcessors;
-		}
-		
 		/**
 		 Returns the current core timestamps (in 100 ns).
 
@@ -130,6 +198,41 @@ namespace mage
 			}
 		}
 
+		/**
+		 Returns the current resource usage (i.e. core timestamps in 100 ns
+		 and resource usage counters).
+
+		 @return		The current resource usage of the calling process
+						(without wall clock time).
+		 @note			If the retrieval fails, the corresponding members are
+						zero. To get extended error information, call
+						@c GetLastError.
+		 */
+		[[nodiscard]]
+		ResourceUsageClock::time_point ResourceUsageSnapshot() noexcept
+		{
+			using duration = SystemTimeInterval;
+
+			const auto core_timestamps = CoreTimestamps();
+
+			ResourceUsageClock::time_point usage = {};
+			usage.m_kernel_mode = duration(core_timestamps.first);
+			usage.m_user_mode   = duration(core_timestamps.second);
+
+			PROCESS_MEMORY_COUNTERS counters = {};
+			// Retrieve memory information for the process.
+			if (FALSE != ::GetProcessMemoryInfo(GetCurrentProcess(),
+												&counters,
+												sizeof(counters)))
+			{
+				// Soft and hard page faults are not distinguished.
+				usage.m_minor_faults          = counters.PageFaultCount;
+				usage.m_max_resident_set_size = counters.PeakWorkingSetSize;
+			}
+
+			return usage;
+		}
+
 		/**
 		 Returns the current core timestamp (in 100 ns).
 
@@ -142,69 +245,112 @@ namespace mage
 			return timestamps.first + timestamps.second;
 		}
 
+#else
+
 		/**
-		 Returns the current kernel mode core timestamp (in 100 ns).
+		 Returns the current core timestamps (in 1 ns).
 
-		 @return		The current kernel mode core timestamp of the calling
-						process.
+		 @return		A pair containing the current kernel and user mode
+						timestamp of the calling process.
+		 @note			If the retrieval fails, both the kernel and user mode
+						timestamp are zero. To get extended error information,
+						check @c errno.
 		 */
 		[[nodiscard]]
-		inline U64 KernelModeCoreTimestamp() noexcept
+		std::pair< U64, U64 > CoreTimestamps() noexcept
 		{
-			const auto timestamps = CoreTimestamps();
-			return timestamps.first;
+			rusage usage;
+			// Retrieve timing information for the process.
+			if (0 != ::getrusage(RUSAGE_SELF, &usage))
+			{
+				return {};
+			}
+			else
+			{
+				return
+				{
+					ConvertTimestamp(usage.ru_stime),
+					ConvertTimestamp(usage.ru_utime)
+				};
+			}
 		}
 
 		/**
-		 Returns the current user mode core timestamp (in 100 ns).
+		 Returns the current resource usage (i.e. core timestamps in 1 ns and
+		 resource usage counters).
 
-		 @return		The current user mode core timestamp of the calling
-						process.
+		 @return		The current resource usage of the calling process
+						(without wall clock time).
+		 @note			If the retrieval fails, all members are zero. To get
+						extended error information, check @c errno.
 		 */
 		[[nodiscard]]
-		inline U64 UserModeCoreTimestamp() noexcept
+		ResourceUsageClock::time_point ResourceUsageSnapshot() noexcept
 		{
-			const auto timestamps = CoreTimestamps();
-			return timestamps.second;
+			using duration = SystemTimeInterval;
+
+			rusage usage;
+			// Retrieve timing and resource information for the process.
+			if (0 != ::getrusage(RUSAGE_SELF, &usage))
+			{
+				return {};
+			}
+			else
+			{
+				return
+				{
+					duration::zero(),
+					duration(ConvertTimestamp(usage.ru_stime)),
+					duration(ConvertTimestamp(usage.ru_utime)),
+					static_cast< U64 >(usage.ru_minflt),
+					static_cast< U64 >(usage.ru_majflt),
+					static_cast< U64 >(usage.ru_nvcsw),
+					static_cast< U64 >(usage.ru_nivcsw),
+					// ru_maxrss is expressed in KiB.
+					static_cast< U64 >(usage.ru_maxrss) * 1024u
+				};
+			}
 		}
 
 		/**
-		 Returns the current core timestamp per system core (in 100 ns).
+		 Returns the current core timestamp (in 1 ns).
 
-		 @return		The current core timestamp of the calling process per
-						system core.
+		 @return		The current core timestamp of the calling process.
 		 */
 		[[nodiscard]]
-		inline U64 CoreTimestampPerCore() noexcept
+		inline U64 CoreTimestamp() noexcept
 		{
-			static const auto s_system_core_count = NumberOfSystemCores();
-			return CoreTimestamp() / s_system_core_count;
+			// CLOCK_PROCESS_CPUTIME_ID has a ns resolution in contrast to the
+			// us resolution of getrusage.
+			return ClockTimestamp(CLOCK_PROCESS_CPUTIME_ID);
 		}
 
+#endif
+
 		/**
-		 Returns the current kernel mode core timestamp per system core (in 100 ns).
+		 Returns the current kernel mode core timestamp.
 
 		 @return		The current kernel mode core timestamp of the calling
-						process per system core.
+						process.
 		 */
 		[[nodiscard]]
-		inline U64 KernelModeCoreTimestampPerCore() noexcept
+		inline U64 KernelModeCoreTimestamp() noexcept
 		{
-			static const auto s_system_core_count = NumberOfSystemCores();
-			return KernelModeCoreTimestamp() / s_system_core_count;
+			const auto timestamps = CoreTimestamps();
+			return timestamps.first;
 		}
 
 		/**
-		 Returns the current user mode core timestamp per system core (in 100 ns).
+		 Returns the current user mode core timestamp.
 
 		 @return		The current user mode core timestamp of the calling
-						process per system core.
+						process.
 		 */
 		[[nodiscard]]
-		inline U64 UserModeCoreTimestampPerCore() noexcept
+		inline U64 UserModeCoreTimestamp() noexcept
 		{
-			static const auto s_system_core_count = NumberOfSystemCores();
-			return UserModeCoreTimestamp() / s_system_core_count;
+			const auto timestamps = CoreTimestamps();
+			return timestamps.second;
 		}
 	}
 
@@ -229,18 +375,163 @@ namespace mage
 	[[nodiscard]]
 	auto CoreClockPerCore::now() noexcept -> time_point
 	{
-		return time_point(duration(CoreTimestampPerCore()));
+		return time_point(duration(CoreTimestamp()));
 	}
 
 	[[nodiscard]]
 	auto KernelModeCoreClockPerCore::now() noexcept -> time_point
 	{
-		return time_point(duration(KernelModeCoreTimestampPerCore()));
+		return time_point(duration(KernelModeCoreTimestamp()));
 	}
 
 	[[nodiscard]]
 	auto UserModeCoreClockPerCore::now() noexcept -> time_point
 	{
-		return time_point(duration(UserModeCoreTimestampPerCore()));
+		return time_point(duration(UserModeCoreTimestamp()));
+	}
+
+	//-------------------------------------------------------------------------
+	// Thread Core Time
+	//-------------------------------------------------------------------------
+	namespace
+	{
+#ifdef _WIN32
+
+		/**
+		 Returns the current thread core timestamps (in 100 ns).
+
+		 @return		A pair containing the current kernel and user mode
+						timestamp of the calling thread.
+		 @note			If the retrieval fails, both the kernel and user mode
+						timestamp are zero. To get extended error information,
+						call @c GetLastError.
+		 */
+		[[nodiscard]]
+		std::pair< U64, U64 > ThreadCoreTimestamps() noexcept
+		{
+			FILETIME ftime;
+			FILETIME kernel_mode_ftime;
+			FILETIME user_mode_ftime;
+			// Retrieve timing information for the thread.
+			if (FALSE == ::GetThreadTimes(GetCurrentThread(),
+										  &ftime,
+										  &ftime,
+										  &kernel_mode_ftime,
+										  &user_mode_ftime))
+			{
+				return {};
+			}
+			else
+			{
+				return
+				{
+					ConvertTimestamp(kernel_mode_ftime),
+					ConvertTimestamp(user_mode_ftime)
+				};
+			}
+		}
+
+		/**
+		 Returns the current thread core timestamp (in 100 ns).
+
+		 @return		The current core timestamp of the calling thread.
+		 */
+		[[nodiscard]]
+		inline U64 ThreadCoreTimestamp() noexcept
+		{
+			const auto timestamps = ThreadCoreTimestamps();
+			return timestamps.first + timestamps.second;
+		}
+
+#else
+
+		/**
+		 Returns the current thread core timestamps (in 1 ns).
+
+		 @return		A pair containing the current kernel and user mode
+						timestamp of the calling thread.
+		 @note			If the retrieval fails, both the kernel and user mode
+						timestamp are zero. To get extended error information,
+						check @c errno.
+		 */
+		[[nodiscard]]
+		std::pair< U64, U64 > ThreadCoreTimestamps() noexcept
+		{
+			rusage usage;
+			// Retrieve timing information for the thread.
+			if (0 != ::getrusage(RUSAGE_THREAD, &usage))
+			{
+				return {};
+			}
+			else
+			{
+				return
+				{
+					ConvertTimestamp(usage.ru_stime),
+					ConvertTimestamp(usage.ru_utime)
+				};
+			}
+		}
+
+		/**
+		 Returns the current thread core timestamp (in 1 ns).
+
+		 @return		The current core timestamp of the calling thread.
+		 */
+		[[nodiscard]]
+		inline U64 ThreadCoreTimestamp() noexcept
+		{
+			return ClockTimestamp(CLOCK_THREAD_CPUTIME_ID);
+		}
+
+#endif
+	}
+
+	[[nodiscard]]
+	auto ThreadCoreClock::now() noexcept -> time_point
+	{
+		return time_point(duration(ThreadCoreTimestamp()));
+	}
+
+	[[nodiscard]]
+	auto KernelModeThreadCoreClock::now() noexcept -> time_point
+	{
+		return time_point(duration(ThreadCoreTimestamps().first));
+	}
+
+	[[nodiscard]]
+	auto UserModeThreadCoreClock::now() noexcept -> time_point
+	{
+		return time_point(duration(ThreadCoreTimestamps().second));
+	}
+
+	//-------------------------------------------------------------------------
+	// Process Time
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	auto ProcessTimesClock::now() noexcept -> time_point
+	{
+		const auto wall_timestamp  = SystemTimestamp();
+		const auto core_timestamps = CoreTimestamps();
+		return
+		{
+			SystemTimeInterval(wall_timestamp),
+			SystemTimeInterval(core_timestamps.first),
+			SystemTimeInterval(core_timestamps.second)
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// Resource Usage
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	auto ResourceUsageClock::now() noexcept -> time_point
+	{
+		const auto wall_timestamp = SystemTimestamp();
+		auto usage = ResourceUsageSnapshot();
+		usage.m_wall = SystemTimeInterval(wall_timestamp);
+		return usage;
 	}
 }
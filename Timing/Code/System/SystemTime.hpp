@@ -4,16 +4,16 @@
 // Includes
 //-----------------------------------------------------------------------------
 
-// U64
+// F64, U64
 #include <Type/ScalarTypes.hpp>
 
 //-----------------------------------------------------------------------------
 // External Includes
 //-----------------------------------------------------------------------------
 
-// duration, time_point
+// duration, duration_cast, time_point
 #include <chrono>
-// ratio
+// nano, ratio
 #include <ratio>
 
 //-----------------------------------------------------------------------------
@@ -21,6 +21,33 @@
 //-----------------------------------------------------------------------------
 namespace mage
 {
+	//-------------------------------------------------------------------------
+	// Period
+	//-------------------------------------------------------------------------
+
+#ifdef _WIN32
+
+	/**
+	 The period of the system and core clocks (i.e. 100 ns, the resolution of
+	 @c FILETIME).
+	 */
+	using SystemTimePeriod = std::ratio< 1, 10'000'000 >;
+
+#else
+
+	/**
+	 The period of the system and core clocks (i.e. 1 ns, the resolution of
+	 @c timespec).
+	 */
+	using SystemTimePeriod = std::nano;
+
+#endif
+
+	/**
+	 The time interval type of the system and core clocks.
+	 */
+	using SystemTimeInterval = std::chrono::duration< U64, SystemTimePeriod >;
+
 	//-------------------------------------------------------------------------
 	// System Time
 	//-------------------------------------------------------------------------
@@ -28,7 +55,7 @@ namespace mage
 	struct SystemClock
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
 		using time_point = std::chrono::time_point< SystemClock >;
 
@@ -45,7 +72,7 @@ namespace mage
 	struct CoreClock
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
 		using time_point = std::chrono::time_point< CoreClock >;
 
@@ -58,7 +85,7 @@ namespace mage
 	struct KernelModeCoreClock
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
 		using time_point = std::chrono::time_point< KernelModeCoreClock >;
 
@@ -71,7 +98,7 @@ namespace mage
 	struct UserModeCoreClock
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
 		using time_point = std::chrono::time_point< UserModeCoreClock >;
 
@@ -81,10 +108,37 @@ namespace mage
 		static time_point now() noexcept;
 	};
 
+	/**
+	 Converts the given duration (in undivided core time) to a time interval
+	 per effective core (see @c GetEffectiveCoreCount). Durations are
+	 divided in ticks if the time interval type is the given duration type.
+
+	 @tparam		TimeIntervalT
+					The time interval type.
+	 @tparam		DurationT
+					The duration type.
+	 @param[in]		time_interval
+					The duration (in undivided core time).
+	 @return		The time interval per effective core corresponding to
+					the given duration.
+	 */
+	template< typename TimeIntervalT, typename DurationT >
+	[[nodiscard]]
+	TimeIntervalT ToPerCoreTimeInterval(DurationT time_interval) noexcept;
+
+	/**
+	 A clock reading the core time of the calling process per effective core
+	 (see @c GetEffectiveCoreCount).
+
+	 The time points of this clock are the undivided core time, so the
+	 clock stays steady when the effective number of cores changes. The
+	 divisor is applied to durations by @c ToTimeInterval (as @c Timer
+	 does), using the effective number of cores at the time of conversion.
+	 */
 	struct CoreClockPerCore
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
 		using time_point = std::chrono::time_point< CoreClockPerCore >;
 
@@ -92,25 +146,80 @@ namespace mage
 
 		[[nodiscard]]
 		static time_point now() noexcept;
+
+		/**
+		 Converts the given duration (in undivided core time) to a time
+		 interval per effective core.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[in]		time_interval
+						The duration (in undivided core time).
+		 @return		The time interval per effective core corresponding
+						to the given duration.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(duration time_interval) noexcept
+		{
+			return ToPerCoreTimeInterval< TimeIntervalT >(time_interval);
+		}
 	};
 
+	/**
+	 A clock reading the kernel mode core time of the calling process per
+	 effective core (see @c GetEffectiveCoreCount).
+
+	 The time points of this clock are the undivided kernel mode core time,
+	 so the clock stays steady when the effective number of cores changes.
+	 The divisor is applied to durations by @c ToTimeInterval (as @c Timer
+	 does), using the effective number of cores at the time of conversion.
+	 */
 	struct KernelModeCoreClockPerCore
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
-		using time_point = std::chrono::time_point< KernelModeCoreClockPerCore >;
+		using time_point
+			= std::chrono::time_point< KernelModeCoreClockPerCore >;
 
 		static constexpr bool is_steady = true;
 
 		[[nodiscard]]
 		static time_point now() noexcept;
+
+		/**
+		 Converts the given duration (in undivided kernel mode core time) to a
+		 time interval per effective core.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[in]		time_interval
+						The duration (in undivided kernel mode core time).
+		 @return		The time interval per effective core corresponding
+						to the given duration.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(duration time_interval) noexcept
+		{
+			return ToPerCoreTimeInterval< TimeIntervalT >(time_interval);
+		}
 	};
 
+	/**
+	 A clock reading the user mode core time of the calling process per
+	 effective core (see @c GetEffectiveCoreCount).
+
+	 The time points of this clock are the undivided user mode core time,
+	 so the clock stays steady when the effective number of cores changes.
+	 The divisor is applied to durations by @c ToTimeInterval (as @c Timer
+	 does), using the effective number of cores at the time of conversion.
+	 */
 	struct UserModeCoreClockPerCore
 	{
 		using rep        = U64;
-		using period     = std::ratio< 1, 10'000'000 >;
+		using period     = SystemTimePeriod;
 		using duration   = std::chrono::duration< rep, period >;
 		using time_point = std::chrono::time_point< UserModeCoreClockPerCore >;
 
@@ -118,5 +227,519 @@ namespace mage
 
 		[[nodiscard]]
 		static time_point now() noexcept;
+
+		/**
+		 Converts the given duration (in undivided user mode core time) to a
+		 time interval per effective core.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[in]		time_interval
+						The duration (in undivided user mode core time).
+		 @return		The time interval per effective core corresponding
+						to the given duration.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(duration time_interval) noexcept
+		{
+			return ToPerCoreTimeInterval< TimeIntervalT >(time_interval);
+		}
+	};
+
+	//-------------------------------------------------------------------------
+	// Thread Core Time
+	//-------------------------------------------------------------------------
+
+	struct ThreadCoreClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< ThreadCoreClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
 	};
-}
\ No newline at end of file
+
+	struct KernelModeThreadCoreClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< KernelModeThreadCoreClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+	};
+
+	struct UserModeThreadCoreClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< UserModeThreadCoreClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+	};
+
+	//-------------------------------------------------------------------------
+	// Process Time
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of process times.
+
+	 @tparam		TimeIntervalT
+					The time interval type.
+	 */
+	template< typename TimeIntervalT >
+	struct ProcessTimes
+	{
+		/**
+		 The time interval type of process times.
+		 */
+		using TimeInterval = TimeIntervalT;
+
+		/**
+		 Returns zero process times.
+
+		 @return		Zero process times.
+		 */
+		[[nodiscard]]
+		static constexpr ProcessTimes zero() noexcept
+		{
+			return {};
+		}
+
+		/**
+		 Adds the given process times to these process times.
+
+		 @param[in]		times
+						A reference to the process times to add.
+		 @return		A reference to the sum of the given process times and
+						these process times (i.e. these process times).
+		 */
+		constexpr ProcessTimes& operator+=(const ProcessTimes& times) noexcept
+		{
+			m_wall        += times.m_wall;
+			m_kernel_mode += times.m_kernel_mode;
+			m_user_mode   += times.m_user_mode;
+			m_core        += times.m_core;
+			return *this;
+		}
+
+		/**
+		 The wall clock time of these process times.
+		 */
+		TimeIntervalT m_wall = TimeIntervalT::zero();
+
+		/**
+		 The kernel mode core time of these process times.
+		 */
+		TimeIntervalT m_kernel_mode = TimeIntervalT::zero();
+
+		/**
+		 The user mode core time of these process times.
+		 */
+		TimeIntervalT m_user_mode = TimeIntervalT::zero();
+
+		/**
+		 The (i.e. kernel and user mode) core time of these process times.
+		 */
+		TimeIntervalT m_core = TimeIntervalT::zero();
+	};
+
+	/**
+	 A clock sampling the wall clock, kernel mode and user mode time of the
+	 calling process together.
+
+	 The durations of this clock are process times, which @c Timer converts
+	 with @c ToTimeInterval (e.g., to @c ProcessTimes< TimeIntervalSeconds >).
+	 */
+	struct ProcessTimesClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = ProcessTimes< SystemTimeInterval >;
+
+		/**
+		 A snapshot of the wall clock, kernel mode and user mode time.
+		 */
+		struct time_point
+		{
+			/**
+			 Returns the smallest snapshot.
+
+			 @return		The smallest snapshot (i.e. all zero).
+			 */
+			[[nodiscard]]
+			static constexpr time_point min() noexcept
+			{
+				return {};
+			}
+
+			/**
+			 Returns the process times between the given snapshots.
+
+			 @param[in]		lhs
+							A reference to the later snapshot.
+			 @param[in]		rhs
+							A reference to the earlier snapshot.
+			 @return		The process times between the given snapshots.
+			 */
+			[[nodiscard]]
+			friend constexpr duration operator-(const time_point& lhs,
+												const time_point& rhs) noexcept
+			{
+				duration times;
+				times.m_wall        = lhs.m_wall        - rhs.m_wall;
+				times.m_kernel_mode = lhs.m_kernel_mode - rhs.m_kernel_mode;
+				times.m_user_mode   = lhs.m_user_mode   - rhs.m_user_mode;
+				times.m_core        = times.m_kernel_mode + times.m_user_mode;
+				return times;
+			}
+
+			/**
+			 The wall clock time of this snapshot.
+			 */
+			SystemTimeInterval m_wall;
+
+			/**
+			 The kernel mode core time of this snapshot.
+			 */
+			SystemTimeInterval m_kernel_mode;
+
+			/**
+			 The user mode core time of this snapshot.
+			 */
+			SystemTimeInterval m_user_mode;
+		};
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+
+		/**
+		 Converts the given process times to the given process times type.
+
+		 @tparam		TimeIntervalT
+						The process times type.
+		 @param[in]		time_interval
+						A reference to the process times to convert.
+		 @return		The converted process times.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(
+			const duration& time_interval) noexcept
+		{
+			using std::chrono::duration_cast;
+			using Interval = typename TimeIntervalT::TimeInterval;
+
+			return
+			{
+				duration_cast< Interval >(time_interval.m_wall),
+				duration_cast< Interval >(time_interval.m_kernel_mode),
+				duration_cast< Interval >(time_interval.m_user_mode),
+				duration_cast< Interval >(time_interval.m_core)
+			};
+		}
+	};
+
+	//-------------------------------------------------------------------------
+	// Resource Usage
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of resource usages.
+
+	 @tparam		TimeIntervalT
+					The time interval type.
+	 */
+	template< typename TimeIntervalT >
+	struct ResourceUsage
+	{
+		/**
+		 The time interval type of resource usages.
+		 */
+		using TimeInterval = TimeIntervalT;
+
+		/**
+		 Returns a zero resource usage.
+
+		 @return		A zero resource usage.
+		 */
+		[[nodiscard]]
+		static constexpr ResourceUsage zero() noexcept
+		{
+			return {};
+		}
+
+		/**
+		 Adds the given (later) resource usage to this resource usage.
+
+		 @param[in]		usage
+						A reference to the resource usage to add.
+		 @return		A reference to the sum of the given resource usage
+						and this resource usage (i.e. this resource usage).
+		 */
+		constexpr ResourceUsage& operator+=(const ResourceUsage& usage) noexcept
+		{
+			m_wall         += usage.m_wall;
+			m_kernel_mode  += usage.m_kernel_mode;
+			m_user_mode    += usage.m_user_mode;
+			m_core         += usage.m_core;
+			m_minor_faults += usage.m_minor_faults;
+			m_major_faults += usage.m_major_faults;
+			m_voluntary_context_switches
+				+= usage.m_voluntary_context_switches;
+			m_involuntary_context_switches
+				+= usage.m_involuntary_context_switches;
+			m_max_resident_set_size = usage.m_max_resident_set_size;
+			m_max_resident_set_size_growth
+				+= usage.m_max_resident_set_size_growth;
+			return *this;
+		}
+
+		/**
+		 The wall clock time of this resource usage.
+		 */
+		TimeIntervalT m_wall = TimeIntervalT::zero();
+
+		/**
+		 The kernel mode core time of this resource usage.
+		 */
+		TimeIntervalT m_kernel_mode = TimeIntervalT::zero();
+
+		/**
+		 The user mode core time of this resource usage.
+		 */
+		TimeIntervalT m_user_mode = TimeIntervalT::zero();
+
+		/**
+		 The (i.e. kernel and user mode) core time of this resource usage.
+		 */
+		TimeIntervalT m_core = TimeIntervalT::zero();
+
+		/**
+		 The number of minor page faults (i.e. without I/O) of this resource
+		 usage. On Windows, this is the total number of page faults.
+		 */
+		U64 m_minor_faults = 0u;
+
+		/**
+		 The number of major page faults (i.e. with I/O) of this resource
+		 usage. Zero on Windows.
+		 */
+		U64 m_major_faults = 0u;
+
+		/**
+		 The number of voluntary context switches (e.g., blocking on I/O or a
+		 lock) of this resource usage. Zero on Windows.
+		 */
+		U64 m_voluntary_context_switches = 0u;
+
+		/**
+		 The number of involuntary context switches (i.e. preemptions) of
+		 this resource usage. Zero on Windows.
+		 */
+		U64 m_involuntary_context_switches = 0u;
+
+		/**
+		 The peak resident set size (in bytes) of the process at the end of
+		 this resource usage.
+		 */
+		U64 m_max_resident_set_size = 0u;
+
+		/**
+		 The growth of the peak resident set size (in bytes) of the process
+		 during this resource usage.
+		 */
+		U64 m_max_resident_set_size_growth = 0u;
+	};
+
+	/**
+	 A clock sampling the wall clock, kernel mode and user mode time together
+	 with the resource usage (i.e. page faults, context switches and peak
+	 resident set size) of the calling process.
+
+	 The durations of this clock are resource usages, which @c Timer converts
+	 with @c ToTimeInterval (e.g., to @c ResourceUsage< TimeIntervalSeconds >).
+	 */
+	struct ResourceUsageClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = ResourceUsage< SystemTimeInterval >;
+
+		/**
+		 A snapshot of the wall clock, kernel mode and user mode time and the
+		 resource usage.
+		 */
+		struct time_point
+		{
+			/**
+			 Returns the smallest snapshot.
+
+			 @return		The smallest snapshot (i.e. all zero).
+			 */
+			[[nodiscard]]
+			static constexpr time_point min() noexcept
+			{
+				return {};
+			}
+
+			/**
+			 Returns the resource usage between the given snapshots.
+
+			 @param[in]		lhs
+							A reference to the later snapshot.
+			 @param[in]		rhs
+							A reference to the earlier snapshot.
+			 @return		The resource usage between the given snapshots.
+			 */
+			[[nodiscard]]
+			friend constexpr duration operator-(const time_point& lhs,
+												const time_point& rhs) noexcept
+			{
+				duration usage;
+				usage.m_wall         = lhs.m_wall         - rhs.m_wall;
+				usage.m_kernel_mode  = lhs.m_kernel_mode  - rhs.m_kernel_mode;
+				usage.m_user_mode    = lhs.m_user_mode    - rhs.m_user_mode;
+				usage.m_core         = usage.m_kernel_mode + usage.m_user_mode;
+				usage.m_minor_faults = lhs.m_minor_faults - rhs.m_minor_faults;
+				usage.m_major_faults = lhs.m_major_faults - rhs.m_major_faults;
+				usage.m_voluntary_context_switches
+					= lhs.m_voluntary_context_switches
+					- rhs.m_voluntary_context_switches;
+				usage.m_involuntary_context_switches
+					= lhs.m_involuntary_context_switches
+					- rhs.m_involuntary_context_switches;
+				usage.m_max_resident_set_size = lhs.m_max_resident_set_size;
+				usage.m_max_resident_set_size_growth
+					= lhs.m_max_resident_set_size
+					- rhs.m_max_resident_set_size;
+				return usage;
+			}
+
+			/**
+			 The wall clock time of this snapshot.
+			 */
+			SystemTimeInterval m_wall;
+
+			/**
+			 The kernel mode core time of this snapshot.
+			 */
+			SystemTimeInterval m_kernel_mode;
+
+			/**
+			 The user mode core time of this snapshot.
+			 */
+			SystemTimeInterval m_user_mode;
+
+			/**
+			 The number of minor page faults (i.e. without I/O) of this
+			 snapshot. On Windows, this is the total number of page faults.
+			 */
+			U64 m_minor_faults;
+
+			/**
+			 The number of major page faults (i.e. with I/O) of this
+			 snapshot. Zero on Windows.
+			 */
+			U64 m_major_faults;
+
+			/**
+			 The number of voluntary context switches (e.g., blocking on I/O
+			 or a lock) of this snapshot. Zero on Windows.
+			 */
+			U64 m_voluntary_context_switches;
+
+			/**
+			 The number of involuntary context switches (i.e. preemptions) of
+			 this snapshot. Zero on Windows.
+			 */
+			U64 m_involuntary_context_switches;
+
+			/**
+			 The peak resident set size (in bytes) of this snapshot.
+			 */
+			U64 m_max_resident_set_size;
+		};
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static time_point now() noexcept;
+
+		/**
+		 Converts the given resource usage to the given resource usage type.
+
+		 @tparam		TimeIntervalT
+						The resource usage type.
+		 @param[in]		time_interval
+						A reference to the resource usage to convert.
+		 @return		The converted resource usage.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(
+			const duration& time_interval) noexcept
+		{
+			using std::chrono::duration_cast;
+			using Interval = typename TimeIntervalT::TimeInterval;
+
+			return
+			{
+				duration_cast< Interval >(time_interval.m_wall),
+				duration_cast< Interval >(time_interval.m_kernel_mode),
+				duration_cast< Interval >(time_interval.m_user_mode),
+				duration_cast< Interval >(time_interval.m_core),
+				time_interval.m_minor_faults,
+				time_interval.m_major_faults,
+				time_interval.m_voluntary_context_switches,
+				time_interval.m_involuntary_context_switches,
+				time_interval.m_max_resident_set_size,
+				time_interval.m_max_resident_set_size_growth
+			};
+		}
+	};
+
+	//-------------------------------------------------------------------------
+	// Null Time
+	//-------------------------------------------------------------------------
+
+	/**
+	 A clock which never advances. Timers of this clock (see
+	 @c DisabledTimer) compile away completely.
+	 */
+	struct NullClock
+	{
+		using rep        = U64;
+		using period     = SystemTimePeriod;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< NullClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static constexpr time_point now() noexcept
+		{
+			return time_point();
+		}
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/SystemTime.inl>
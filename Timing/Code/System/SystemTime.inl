@@ -0,0 +1,42 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// GetEffectiveCoreCount
+#include <System/CoreCount.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// is_same_v
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	template< typename TimeIntervalT, typename DurationT >
+	[[nodiscard]]
+	inline TimeIntervalT
+		ToPerCoreTimeInterval(DurationT time_interval) noexcept
+	{
+		const auto core_count = GetEffectiveCoreCount();
+
+		if constexpr (std::is_same_v< TimeIntervalT, DurationT >)
+		{
+			return DurationT(time_interval.count() / core_count);
+		}
+		else
+		{
+			using TimeInterval = std::chrono::duration<
+				F64, typename DurationT::period >;
+			return std::chrono::duration_cast< TimeIntervalT >(TimeInterval(
+				static_cast< F64 >(time_interval.count())
+				/ static_cast< F64 >(core_count)));
+		}
+	}
+}
@@ -4,7 +4,10 @@
 // Includes
 //-----------------------------------------------------------------------------
 
-// CoreClockPerCore
+// GetClockCalibration, NowFenced
+#include <System/ClockCalibration.hpp>
+// CoreClockPerCore, NullClock, ProcessTimesClock, ResourceUsageClock,
+// ThreadCoreClock
 #include <System/SystemTime.hpp>
 // F64
 #include <Type/ScalarTypes.hpp>
@@ -15,9 +18,26 @@
 
 // duration, duration_cast, high_resolution_clock
 #include <chrono>
+// totally_ordered
+#include <concepts>
+// conditional_t, is_empty_v
+#include <type_traits>
 // pair
 #include <utility>
 
+//-----------------------------------------------------------------------------
+// Defines
+//-----------------------------------------------------------------------------
+
+/**
+ The default instrumentation flag of conditional timers (see
+ @c ConditionalTimer). Define as 0 to disable all conditional timers that do
+ not pass their own (e.g., per subsystem) flag.
+ */
+#ifndef MAGE_TIMING_ENABLED
+#define MAGE_TIMING_ENABLED 1
+#endif
+
 //-----------------------------------------------------------------------------
 // Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -37,6 +57,28 @@ namespace mage
 	 */
 	using TimeIntervalSeconds = std::chrono::duration< F64 >;
 
+	/**
+	 Converts the given time interval of the given clock to the given time
+	 interval type.
+
+	 Clocks whose period is only known at runtime (e.g., @c TscClock) or
+	 whose durations are not @c std::chrono::duration (e.g.,
+	 @c ProcessTimesClock) provide a static @c ToTimeInterval member method
+	 which is used instead of @c std::chrono::duration_cast.
+
+	 @tparam		ClockT
+					The clock type.
+	 @tparam		TimeIntervalT
+					The time interval type.
+	 @param[in]		time_interval
+					A reference to the time interval to convert.
+	 @return		The converted time interval.
+	 */
+	template< typename ClockT, typename TimeIntervalT >
+	[[nodiscard]]
+	TimeIntervalT ConvertTimeInterval(
+		const typename ClockT::duration& time_interval) noexcept;
+
 	//-------------------------------------------------------------------------
 	// Timer
 	//-------------------------------------------------------------------------
@@ -130,6 +172,23 @@ namespace mage
 		 */
 		void Resume() noexcept;
 
+		/**
+		 Enables or disables the subtraction of the measurement overhead (i.e.
+		 the calibrated difference between two back-to-back time points of
+		 the clock) from every interval between starting or resuming and
+		 stopping this timer. Intervals shorter than the overhead are clamped
+		 to zero.
+
+		 @param[in]		enable
+						@c true to subtract the measurement overhead.
+						@c false otherwise.
+		 @note			The clock is calibrated on first use (see
+						@c GetClockCalibration).
+		 @note			Ignored for clocks whose time intervals are not
+						totally ordered (e.g., @c ProcessTimesClock).
+		 */
+		void SetOverheadCompensation(bool enable) noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: (Total) Delta Time
 		//---------------------------------------------------------------------
@@ -183,6 +242,19 @@ namespace mage
 		 */
 		void UpdateDeltaTime() noexcept;
 
+		/**
+		 Adds the given delta time to the interval time of this timer and
+		 subtracts the measurement overhead of this timer (if any) once per
+		 interval.
+
+		 @param[in]		delta_time
+						A reference to the uncompensated delta time.
+		 @return		The compensated delta time.
+		 */
+		[[nodiscard]]
+		typename ClockT::duration CompensateOverhead(
+			const typename ClockT::duration& delta_time) noexcept;
+
 		//---------------------------------------------------------------------
 		// Class Member Types
 		//---------------------------------------------------------------------
@@ -222,12 +294,159 @@ namespace mage
 		 */
 		TimeInterval m_total_delta_time = TimeInterval::zero();
 
+		/**
+		 The uncompensated time since this timer was last started or resumed.
+		 */
+		TimeInterval m_interval_time = TimeInterval::zero();
+
+		/**
+		 The measurement overhead subtracted once from every interval between
+		 starting or resuming and stopping this timer.
+		 */
+		TimeInterval m_overhead = TimeInterval::zero();
+
 		/**
 		 Flag indicating whether this timer is running.
 		 */
 		bool m_running = false;
 	};
 
+	//-------------------------------------------------------------------------
+	// Timer< NullClock >
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of disabled timers. All member methods are empty and
+	 @c constexpr (i.e. no clock is read) and all (total) delta times are
+	 zero.
+	 */
+	template<>
+	class Timer< NullClock >
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a timer.
+		 */
+		constexpr Timer() noexcept = default;
+
+		/**
+		 Constructs a timer from the given timer.
+
+		 @param[in]		timer
+						A reference to the timer to copy.
+		 */
+		constexpr Timer(const Timer& timer) noexcept = default;
+
+		/**
+		 Constructs a timer by moving the given timer.
+
+		 @param[in]		timer
+						A reference to the timer to move.
+		 */
+		constexpr Timer(Timer&& timer) noexcept = default;
+
+		/**
+		 Destructs this timer.
+		 */
+		constexpr ~Timer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given timer to this timer.
+
+		 @param[in]		timer
+						A reference to the timer to copy.
+		 @return		A reference to the copy of the given timer (i.e. this
+						timer).
+		 */
+		constexpr Timer& operator=(const Timer& timer) noexcept = default;
+
+		/**
+		 Moves the given timer to this timer.
+
+		 @param[in]		timer
+						A reference to the timer to move.
+		 @return		A reference to the moved timer (i.e. this timer).
+		 */
+		constexpr Timer& operator=(Timer&& timer) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts this timer.
+		 */
+		constexpr void Start() noexcept;
+
+		/**
+		 Stops this timer.
+		 */
+		constexpr void Stop() noexcept;
+
+		/**
+		 Restarts this timer.
+		 */
+		constexpr void Restart() noexcept;
+
+		/**
+		 Resumes this timer.
+		 */
+		constexpr void Resume() noexcept;
+
+		/**
+		 Enables or disables the subtraction of the measurement overhead.
+
+		 @param[in]		enable
+						@c true to subtract the measurement overhead.
+						@c false otherwise.
+		 */
+		constexpr void SetOverheadCompensation(bool enable) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: (Total) Delta Time
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the delta time (in seconds) of this timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		Zero.
+		 */
+		template< typename TimeIntervalT >
+		constexpr TimeIntervalT DeltaTime() noexcept;
+
+		/**
+		 Returns the total delta time (in seconds) of this timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		Zero.
+		 */
+		template< typename TimeIntervalT >
+		constexpr TimeIntervalT TotalDeltaTime() noexcept;
+
+		/**
+		 Returns the delta and total delta time (in seconds) of this timer.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @return		A pair containing zero twice.
+		 */
+		template< typename TimeIntervalT >
+		constexpr std::pair< TimeIntervalT, TimeIntervalT > Time() noexcept;
+	};
+
 	//-------------------------------------------------------------------------
 	// Type Declarations and Definitions
 	//-------------------------------------------------------------------------
@@ -241,6 +460,62 @@ namespace mage
 	 A class of CPU (i.e. core clock per core) timers.
 	 */
 	using CpuTimer = Timer< CoreClockPerCore >;
+
+	/**
+	 A class of thread CPU (i.e. thread core clock) timers.
+	 */
+	using ThreadCpuTimer = Timer< ThreadCoreClock >;
+
+	/**
+	 A class of process times timers.
+
+	 In contrast to a pair of @c Timer< KernelModeCoreClock > and
+	 @c Timer< UserModeCoreClock >, the wall clock, kernel mode and user mode
+	 time are sampled together (i.e. with a single process times query per
+	 timestamp), resulting in consistent intervals. The time interval types
+	 are process times (e.g., @c DeltaTime< ProcessTimes< TimeIntervalSeconds
+	 > >).
+	 */
+	using ProcessTimesTimer = Timer< ProcessTimesClock >;
+
+	/**
+	 A class of resource timers.
+
+	 The wall clock, kernel mode and user mode time and the resource usage
+	 counters (i.e. page faults, context switches and peak resident set size)
+	 are sampled together (i.e. with a single resource usage query per
+	 timestamp), which allows to attribute a slow interval to paging,
+	 preemption or computation. The time interval types are resource usages
+	 (e.g., @c DeltaTime< ResourceUsage< TimeIntervalSeconds > >).
+	 */
+	using ResourceTimer = Timer< ResourceUsageClock >;
+
+	/**
+	 A class of disabled timers.
+	 */
+	using DisabledTimer = Timer< NullClock >;
+
+	/**
+	 A class of timers which can be disabled at compile time (e.g., per
+	 subsystem) without changing the call sites:
+
+	 @code
+	 #ifndef PHYSICS_TIMING_ENABLED
+	 #define PHYSICS_TIMING_ENABLED MAGE_TIMING_ENABLED
+	 #endif
+
+	 using PhysicsTimer = ConditionalTimer< CoreClockPerCore,
+	                                        PHYSICS_TIMING_ENABLED >;
+	 @endcode
+
+	 @tparam		ClockT
+					The clock type.
+	 @tparam		EnabledV
+					Flag indicating whether the timers are enabled.
+	 */
+	template< typename ClockT, bool EnabledV = (0 != MAGE_TIMING_ENABLED) >
+	using ConditionalTimer
+		= Timer< std::conditional_t< EnabledV, ClockT, NullClock > >;
 }
 
 //-----------------------------------------------------------------------------
@@ -5,6 +5,32 @@
 //-----------------------------------------------------------------------------
 namespace mage
 {
+	template< typename ClockT, typename TimeIntervalT >
+	[[nodiscard]]
+	inline TimeIntervalT ConvertTimeInterval(
+		const typename ClockT::duration& time_interval) noexcept
+	{
+		constexpr bool has_conversion
+			= requires (const typename ClockT::duration& interval)
+		{
+			ClockT::template ToTimeInterval< TimeIntervalT >(interval);
+		};
+
+		if constexpr (has_conversion)
+		{
+			return ClockT::template ToTimeInterval< TimeIntervalT >(
+				time_interval);
+		}
+		else
+		{
+			return std::chrono::duration_cast< TimeIntervalT >(time_interval);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Timer
+	//-------------------------------------------------------------------------
+
 	template< typename ClockT >
 	inline void Timer< ClockT >::Start() noexcept
 	{
@@ -45,9 +71,20 @@ namespace mage
 		}
 
 		m_running = true;
+		m_interval_time  = TimeInterval::zero();
 		m_last_timestamp = m_clock.now();
 	}
 
+	template< typename ClockT >
+	inline void Timer< ClockT >::SetOverheadCompensation(bool enable) noexcept
+	{
+		if constexpr (std::totally_ordered< TimeInterval >)
+		{
+			m_overhead = enable ? GetClockCalibration< ClockT >().m_overhead
+								: TimeInterval::zero();
+		}
+	}
+
 	template< typename ClockT >
 	template< typename TimeIntervalT >
 	inline TimeIntervalT Timer< ClockT >::DeltaTime() noexcept
@@ -57,7 +94,7 @@ namespace mage
 			UpdateDeltaTime();
 		}
 
-		return std::chrono::duration_cast< TimeIntervalT >(m_delta_time);
+		return ConvertTimeInterval< ClockT, TimeIntervalT >(m_delta_time);
 	}
 
 	template< typename ClockT >
@@ -69,7 +106,7 @@ namespace mage
 			UpdateDeltaTime();
 		}
 
-		return std::chrono::duration_cast< TimeIntervalT >(m_total_delta_time);
+		return ConvertTimeInterval< ClockT, TimeIntervalT >(m_total_delta_time);
 	}
 
 	template< typename ClockT >
@@ -84,8 +121,8 @@ namespace mage
 
 		return
 		{
-			std::chrono::duration_cast< TimeIntervalT >(m_delta_time),
-			std::chrono::duration_cast< TimeIntervalT >(m_total_delta_time)
+			ConvertTimeInterval< ClockT, TimeIntervalT >(m_delta_time),
+			ConvertTimeInterval< ClockT, TimeIntervalT >(m_total_delta_time)
 		};
 	}
 
@@ -96,6 +133,8 @@ namespace mage
 		m_delta_time = TimeInterval::zero();
 		// Resets the total delta time of this timer.
 		m_total_delta_time = TimeInterval::zero();
+		// Resets the interval time of this timer.
+		m_interval_time = TimeInterval::zero();
 		// Resets the last timestamp of this timer.
 		m_last_timestamp = m_clock.now();
 	}
@@ -104,13 +143,94 @@ namespace mage
 	inline void Timer< ClockT >::UpdateDeltaTime() noexcept
 	{
 		// Get the current timestamp of this timer.
-		const auto current_timestamp = m_clock.now();
+		const auto current_timestamp = NowFenced(m_clock);
 
 		// Updates the delta time of this timer.
-		m_delta_time = current_timestamp - m_last_timestamp;
+		m_delta_time = CompensateOverhead(current_timestamp - m_last_timestamp);
 		// Updates the total delta time of this timer.
 		m_total_delta_time += m_delta_time;
 		// Updates the last timestamp of this timer.
 		m_last_timestamp = current_timestamp;
 	}
+
+	template< typename ClockT >
+	[[nodiscard]]
+	inline typename ClockT::duration Timer< ClockT >::CompensateOverhead(
+		const typename ClockT::duration& delta_time) noexcept
+	{
+		if constexpr (std::totally_ordered< TimeInterval >)
+		{
+			const auto compensate = [this](const TimeInterval& interval_time)
+			{
+				return (m_overhead < interval_time)
+					? interval_time - m_overhead : TimeInterval::zero();
+			};
+
+			// The measurement overhead (if any) is subtracted once per
+			// interval, so intermediate reads of a running timer do not
+			// subtract it again.
+			const auto previous_interval_time = compensate(m_interval_time);
+			m_interval_time += delta_time;
+			return compensate(m_interval_time) - previous_interval_time;
+		}
+		else
+		{
+			return delta_time;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Timer< NullClock >
+	//-------------------------------------------------------------------------
+
+	constexpr void Timer< NullClock >::Start() noexcept
+	{}
+
+	constexpr void Timer< NullClock >::Stop() noexcept
+	{}
+
+	constexpr void Timer< NullClock >::Restart() noexcept
+	{}
+
+	constexpr void Timer< NullClock >::Resume() noexcept
+	{}
+
+	constexpr void Timer< NullClock >
+		::SetOverheadCompensation([[maybe_unused]] bool enable) noexcept
+	{}
+
+	template< typename TimeIntervalT >
+	constexpr TimeIntervalT Timer< NullClock >::DeltaTime() noexcept
+	{
+		return TimeIntervalT::zero();
+	}
+
+	template< typename TimeIntervalT >
+	constexpr TimeIntervalT Timer< NullClock >::TotalDeltaTime() noexcept
+	{
+		return TimeIntervalT::zero();
+	}
+
+	template< typename TimeIntervalT >
+	constexpr std::pair< TimeIntervalT, TimeIntervalT >
+		Timer< NullClock >::Time() noexcept
+	{
+		return { TimeIntervalT::zero(), TimeIntervalT::zero() };
+	}
+
+	// Disabled timers have no state and are usable in constant expressions,
+	// which rules out reading any clock.
+	static_assert(std::is_empty_v< DisabledTimer >);
+	static_assert([]() noexcept
+	{
+		DisabledTimer timer;
+		timer.Start();
+		timer.Resume();
+		timer.Stop();
+		timer.Restart();
+		return TimeIntervalSeconds::zero()
+			== timer.DeltaTime< TimeIntervalSeconds >()
+			&& TimeIntervalSeconds::zero()
+			== timer.TotalDeltaTime< TimeIntervalSeconds >();
+	}());
 }
@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// Declarations
+#include <System/TscClock.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// duration, duration_cast, steady_clock
+#include <chrono>
+// sleep_for
+#include <thread>
+
+#if defined(_MSC_VER)
+
+// __cpuid
+#include <intrin.h>
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+// __get_cpuid
+#include <cpuid.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	namespace
+	{
+		/**
+		 The duration of the calibration of the time stamp counter.
+		 */
+		constexpr std::chrono::milliseconds g_calibration_duration(20);
+
+		/**
+		 Calibrates the number of ticks per second of the time stamp counter
+		 against the steady clock.
+
+		 @return		The number of ticks per second of the time stamp
+						counter.
+		 */
+		[[nodiscard]]
+		F64 CalibrateTicksPerSecond() noexcept
+		{
+			using Clock   = std::chrono::steady_clock;
+			using Seconds = std::chrono::duration< F64 >;
+
+			// Brackets each counter read by two steady clock reads to
+			// bound the error introduced by the reads themselves.
+			const auto start0     = Clock::now();
+			const auto start_tick = TscClock::now();
+			const auto start1     = Clock::now();
+
+			std::this_thread::sleep_for(g_calibration_duration);
+
+			const auto end0       = Clock::now();
+			const auto end_tick   = TscClock::now();
+			const auto end1       = Clock::now();
+
+			const auto start = start0 + (start1 - start0) / 2;
+			const auto end   = end0   + (end1   - end0)   / 2;
+			const auto seconds
+				= std::chrono::duration_cast< Seconds >(end - start).count();
+			const auto ticks
+				= static_cast< F64 >((end_tick - start_tick).count());
+
+			return (0.0 < seconds && 0.0 < ticks) ? ticks / seconds : 1.0;
+		}
+	}
+
+	[[nodiscard]]
+	bool TscClock::DetectInvariant() noexcept
+	{
+#if defined(_M_X64) || defined(_M_IX86)
+
+		int registers[4] = {};
+		__cpuid(registers, 0x80000000);
+		if (static_cast< unsigned int >(registers[0]) < 0x80000007u)
+		{
+			return false;
+		}
+
+		// CPUID.80000007H:EDX[8] indicates an invariant TSC.
+		__cpuid(registers, 0x80000007);
+		return 0 != (registers[3] & (1 << 8));
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+		unsigned int eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+		if (0 == __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx))
+		{
+			return false;
+		}
+
+		// CPUID.80000007H:EDX[8] indicates an invariant TSC.
+		return 0u != (edx & (1u << 8u));
+
+#elif defined(__aarch64__)
+
+		// The virtual counter is invariant by architecture.
+		return true;
+
+#else
+
+		// The steady clock is used as a fallback.
+		return true;
+
+#endif
+	}
+
+	[[nodiscard]]
+	F64 TscClock::TicksPerSecond() noexcept
+	{
+#if defined(__aarch64__) && !defined(_MSC_VER)
+
+		// The frequency of the virtual counter is reported by the processor.
+		static const F64 s_ticks_per_second = []() noexcept
+		{
+			U64 frequency;
+			asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+			return static_cast< F64 >(frequency);
+		}();
+
+#else
+
+		// The steady clock is read instead of a non-invariant counter.
+		static const F64 s_ticks_per_second = IsInvariant()
+			? CalibrateTicksPerSecond()
+			: static_cast< F64 >(std::chrono::steady_clock::period::den)
+			/ static_cast< F64 >(std::chrono::steady_clock::period::num);
+
+#endif
+
+		return s_ticks_per_second;
+	}
+}
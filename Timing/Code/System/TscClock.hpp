@@ -0,0 +1,331 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+// F64, U64
+#include <Type/ScalarTypes.hpp>
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// strong_ordering
+#include <compare>
+// duration, time_point
+#include <chrono>
+// ratio
+#include <ratio>
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	//-------------------------------------------------------------------------
+	// Time Stamp Counter Ticks
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of time stamp counter ticks.
+
+	 Ticks only convert explicitly from and to arithmetic types. Durations
+	 with ticks as representation therefore have no common type with any
+	 other duration, which makes @c std::chrono::duration_cast (and mixed
+	 arithmetic) ill-formed instead of silently assuming the nominal
+	 @a period.
+	 */
+	class TscTicks
+	{
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs zero ticks.
+		 */
+		constexpr TscTicks() noexcept = default;
+
+		/**
+		 Constructs ticks.
+
+		 @param[in]		count
+						The number of ticks.
+		 */
+		constexpr explicit TscTicks(U64 count) noexcept
+			: m_count(count)
+		{}
+
+		/**
+		 Constructs ticks from the given ticks.
+
+		 @param[in]		ticks
+						A reference to the ticks to copy.
+		 */
+		constexpr TscTicks(const TscTicks& ticks) noexcept = default;
+
+		/**
+		 Constructs ticks by moving the given ticks.
+
+		 @param[in]		ticks
+						A reference to the ticks to move.
+		 */
+		constexpr TscTicks(TscTicks&& ticks) noexcept = default;
+
+		/**
+		 Destructs these ticks.
+		 */
+		~TscTicks() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given ticks to these ticks.
+
+		 @param[in]		ticks
+						A reference to the ticks to copy.
+		 @return		A reference to the copy of the given ticks (i.e.
+						these ticks).
+		 */
+		constexpr TscTicks& operator=(const TscTicks& ticks) noexcept
+			= default;
+
+		/**
+		 Moves the given ticks to these ticks.
+
+		 @param[in]		ticks
+						A reference to the ticks to move.
+		 @return		A reference to the moved ticks (i.e. these ticks).
+		 */
+		constexpr TscTicks& operator=(TscTicks&& ticks) noexcept = default;
+
+		/**
+		 Adds the given ticks to these ticks.
+
+		 @param[in]		ticks
+						The ticks to add.
+		 @return		A reference to these ticks.
+		 */
+		constexpr TscTicks& operator+=(TscTicks ticks) noexcept
+		{
+			m_count += ticks.m_count;
+			return *this;
+		}
+
+		/**
+		 Subtracts the given ticks from these ticks.
+
+		 @param[in]		ticks
+						The ticks to subtract.
+		 @return		A reference to these ticks.
+		 */
+		constexpr TscTicks& operator-=(TscTicks ticks) noexcept
+		{
+			m_count -= ticks.m_count;
+			return *this;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of ticks of these ticks.
+
+		 @return		The number of ticks of these ticks.
+		 */
+		[[nodiscard]]
+		constexpr explicit operator U64() const noexcept
+		{
+			return m_count;
+		}
+
+		/**
+		 Returns the number of ticks of these ticks.
+
+		 @return		The number of ticks of these ticks.
+		 */
+		[[nodiscard]]
+		constexpr explicit operator F64() const noexcept
+		{
+			return static_cast< F64 >(m_count);
+		}
+
+		/**
+		 Returns the sum of the given ticks.
+
+		 @param[in]		lhs
+						The first ticks.
+		 @param[in]		rhs
+						The second ticks.
+		 @return		The sum of the given ticks.
+		 */
+		[[nodiscard]]
+		friend constexpr TscTicks operator+(TscTicks lhs,
+										   TscTicks rhs) noexcept
+		{
+			return lhs += rhs;
+		}
+
+		/**
+		 Returns the difference of the given ticks.
+
+		 @param[in]		lhs
+						The first ticks.
+		 @param[in]		rhs
+						The second ticks.
+		 @return		The difference of the given ticks.
+		 */
+		[[nodiscard]]
+		friend constexpr TscTicks operator-(TscTicks lhs,
+										   TscTicks rhs) noexcept
+		{
+			return lhs -= rhs;
+		}
+
+		/**
+		 Compares the given ticks.
+
+		 @param[in]		lhs
+						The first ticks.
+		 @param[in]		rhs
+						The second ticks.
+		 @return		The ordering of the given ticks.
+		 */
+		[[nodiscard]]
+		friend constexpr auto operator<=>(TscTicks lhs,
+										  TscTicks rhs) noexcept = default;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of ticks of these ticks.
+		 */
+		U64 m_count = 0u;
+	};
+
+	//-------------------------------------------------------------------------
+	// Time Stamp Counter Time
+	//-------------------------------------------------------------------------
+
+	/**
+	 A clock reading the time stamp counter (TSC) of the processor.
+
+	 The durations of this clock are expressed in raw ticks: the tick
+	 frequency is only known at runtime (i.e. after calibrating against the
+	 steady clock). @a period is a nominal one tick and @a rep is the
+	 distinct @c TscTicks type, so durations cannot be converted with
+	 @c std::chrono::duration_cast; they must be converted with
+	 @c ToTimeInterval (as @c Timer does).
+
+	 If the time stamp counter is not invariant (see @c IsInvariant), the
+	 clock falls back to the steady clock (whose ticks are then reported by
+	 @c TicksPerSecond), since a counter whose rate depends on the power and
+	 frequency state of the processor does not measure time.
+	 */
+	struct TscClock
+	{
+		using rep        = TscTicks;
+		using period     = std::ratio< 1 >;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< TscClock >;
+
+		static constexpr bool is_steady = true;
+
+		/**
+		 Returns the current time point of this clock. The counter is read as
+		 soon as possible (i.e. without waiting for preceding instructions),
+		 which suits the start of a measured interval.
+
+		 @return		The current time point of this clock.
+		 */
+		[[nodiscard]]
+		static time_point now() noexcept;
+
+		/**
+		 Returns the current time point of this clock after all preceding
+		 instructions completed (i.e. @c rdtscp followed by @c lfence on
+		 x86), which suits the end of a measured interval: neither the
+		 measured instructions nor the subsequent ones leak into the other
+		 side of the read.
+
+		 @return		The current time point of this clock.
+		 */
+		[[nodiscard]]
+		static time_point NowFenced() noexcept;
+
+		/**
+		 Checks whether the time stamp counter is invariant (i.e. ticks at a
+		 constant rate independent of the power and frequency state of the
+		 processor).
+
+		 @return		@c true if the time stamp counter is invariant.
+						@c false otherwise (i.e. this clock reads the steady
+						clock).
+		 @note			Hypervisors may hide the invariance of the time stamp
+						counter of the host.
+		 */
+		[[nodiscard]]
+		static bool IsInvariant() noexcept;
+
+		/**
+		 Returns the calibrated number of ticks per second.
+
+		 @return		The calibrated number of ticks per second.
+		 @note			The counter is calibrated on first use (i.e. the
+						first call blocks for about 20 ms).
+		 */
+		[[nodiscard]]
+		static F64 TicksPerSecond() noexcept;
+
+		/**
+		 Converts the given duration (in ticks) to a time interval. Durations
+		 are returned as is (i.e. in ticks) if the time interval type is
+		 @c duration.
+
+		 @tparam		TimeIntervalT
+						The time interval type.
+		 @param[in]		time_interval
+						The duration (in ticks).
+		 @return		The time interval corresponding to the given duration.
+		 */
+		template< typename TimeIntervalT >
+		[[nodiscard]]
+		static TimeIntervalT ToTimeInterval(duration time_interval) noexcept;
+
+	private:
+
+		/**
+		 Checks whether the time stamp counter of the processor is invariant.
+
+		 @return		@c true if the time stamp counter is invariant.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool DetectInvariant() noexcept;
+
+		/**
+		 Returns the current time point of the steady clock as a time point
+		 of this clock.
+
+		 @return		The current time point of the steady clock.
+		 */
+		[[nodiscard]]
+		static time_point SteadyNow() noexcept;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <System/TscClock.inl>
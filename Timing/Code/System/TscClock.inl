@@ -0,0 +1,122 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// External Includes
+//-----------------------------------------------------------------------------
+
+// steady_clock
+#include <chrono>
+// is_same_v
+#include <type_traits>
+
+#if defined(_MSC_VER)
+
+// __rdtsc, __rdtscp, _mm_lfence
+#include <intrin.h>
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+// __rdtsc, __rdtscp, _mm_lfence
+#include <x86intrin.h>
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Definitions
+//-----------------------------------------------------------------------------
+namespace mage
+{
+	[[nodiscard]]
+	inline auto TscClock::now() noexcept -> time_point
+	{
+#if defined(_M_X64) || defined(_M_IX86) \
+ || defined(__x86_64__) || defined(__i386__)
+
+		if (!IsInvariant()) [[unlikely]]
+		{
+			return SteadyNow();
+		}
+
+		// rdtsc is not serializing: the counter is read as soon as possible
+		// (i.e. about 20 cycles) at the expense of a few cycles of jitter.
+		return time_point(duration(TscTicks(__rdtsc())));
+
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+
+		// The virtual counter is invariant by architecture.
+		U64 ticks;
+		asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+		return time_point(duration(TscTicks(ticks)));
+
+#else
+
+		return SteadyNow();
+
+#endif
+	}
+
+	[[nodiscard]]
+	inline auto TscClock::NowFenced() noexcept -> time_point
+	{
+#if defined(_M_X64) || defined(_M_IX86) \
+ || defined(__x86_64__) || defined(__i386__)
+
+		if (!IsInvariant()) [[unlikely]]
+		{
+			return SteadyNow();
+		}
+
+		// rdtscp waits until all preceding instructions executed and the
+		// fence keeps subsequent instructions from starting before the read.
+		unsigned int processor;
+		const auto ticks = __rdtscp(&processor);
+		_mm_lfence();
+		return time_point(duration(TscTicks(ticks)));
+
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+
+		// The instruction barrier waits until all preceding instructions
+		// executed.
+		U64 ticks;
+		asm volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+		return time_point(duration(TscTicks(ticks)));
+
+#else
+
+		return SteadyNow();
+
+#endif
+	}
+
+	[[nodiscard]]
+	inline bool TscClock::IsInvariant() noexcept
+	{
+		static const bool s_invariant = DetectInvariant();
+		return s_invariant;
+	}
+
+	[[nodiscard]]
+	inline auto TscClock::SteadyNow() noexcept -> time_point
+	{
+		return time_point(duration(TscTicks(static_cast< U64 >(
+			std::chrono::steady_clock::now().time_since_epoch().count()))));
+	}
+
+	template< typename TimeIntervalT >
+	[[nodiscard]]
+	inline TimeIntervalT
+		TscClock::ToTimeInterval(duration time_interval) noexcept
+	{
+		if constexpr (std::is_same_v< TimeIntervalT, duration >)
+		{
+			// Raw ticks are returned as is.
+			return time_interval;
+		}
+		else
+		{
+			const std::chrono::duration< F64 > seconds(
+				static_cast< F64 >(time_interval.count()) / TicksPerSecond());
+			return std::chrono::duration_cast< TimeIntervalT >(seconds);
+		}
+	}
+}
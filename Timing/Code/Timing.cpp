@@ -2,46 +2,491 @@
 // Includes
 //-----------------------------------------------------------------------------
 
-// CpuTimer, WallClockTimer
-#include <System/Timer.hpp>
+// DoNotOptimize, MAGE_BENCHMARK, RunBenchmarks, Write*Report
+#include <Benchmark/Benchmark.hpp>
+// CompareBenchmarks, ReadBaseline, WriteBaseline, WriteComparisonReport
+#include <Benchmark/Baseline.hpp>
+// BinaryTraceReader, BinaryTraceWriter, WriteBinaryTraceAsChromeJson,
+// WriteBinaryTraceSummary
+#include <Profiling/BinaryTrace.hpp>
+// ParallelFor, WriteParallelReport
+#include <Profiling/ParallelFor.hpp>
+// StartSamplingProfiler, StopSamplingProfiler, GetSamplingProfile, Write*
+#include <Profiling/SamplingProfiler.hpp>
+// SharedTraceRegion, SharedTraceWriter, WriteSharedTraceAsChromeJson
+#include <Profiling/SharedTrace.hpp>
+// MAGE_TRACE_SCOPE, TraceBuffer, TraceEvent
+#include <Profiling/TraceRecorder.hpp>
 
 //-----------------------------------------------------------------------------
 // System Includes
 //-----------------------------------------------------------------------------
 
+// milliseconds
+#include <chrono>
 // log
 #include <cmath>
-// cout, endl
+// int64_t
+#include <cstdint>
+// strtod, strtoul, strtoull
+#include <cstdlib>
+// ifstream, ofstream
+#include <fstream>
+// cerr, cout
 #include <iostream>
+// optional
+#include <optional>
+// string_view
+#include <string_view>
+// vector
+#include <vector>
 
 //-----------------------------------------------------------------------------
-// Declarations
+// Declarations and Definitions
 //-----------------------------------------------------------------------------
-int main()
+namespace
 {
-	mage::WallClockTimer wall_clock_timer;
-	mage::CpuTimer cpu_timer;
+	/**
+	 Sums the logarithms of a range of integers in parallel.
 
-	wall_clock_timer.Start();
-	cpu_timer.Start();
+	 @param[in]		iteration_count
+					The number of iterations.
+	 */
+	void ParallelLogSum(mage::U64 iteration_count)
+	{
+		constexpr std::int64_t count = 1000000;
+
+		for (mage::U64 iteration = 0u; iteration < iteration_count; ++iteration)
+		{
+			//  Perform some computation.
+			double sum = 0.0;
+			#pragma omp parallel for schedule(static, 1) reduction(+ : sum)
+			for (std::int64_t i = 1; i <= count; ++i)
+			{
+				sum += std::log(static_cast< double >(i));
+			}
+
+			mage::DoNotOptimize(sum);
+		}
+	}
+
+	MAGE_BENCHMARK(ParallelLogSum);
+
+	/**
+	 Flag indicating whether the benchmarks are the only consumer of the
+	 trace buffers (i.e. no binary trace writer drains them).
+	 */
+	bool g_consume_trace_buffers = true;
+
+	/**
+	 Records pairs of begin and end trace events (i.e. a
+	 @c MAGE_TRACE_SCOPE) on the trace buffer of the calling thread. The
+	 cost per trace event is half the time per iteration. Unless a binary
+	 trace writer drains the trace buffers, the trace buffer is drained
+	 whenever it is half full, so no trace events are dropped.
+
+	 @param[in]		iteration_count
+					The number of iterations.
+	 */
+	void TraceScopeBeginEnd(mage::U64 iteration_count)
+	{
+		constexpr mage::U64 drain_mask
+			= mage::TraceBuffer::s_capacity / 4u - 1u;
+
+		auto& buffer = mage::TraceBuffer::Get();
+		for (mage::U64 iteration = 0u; iteration < iteration_count; ++iteration)
+		{
+			{
+				MAGE_TRACE_SCOPE("TraceScopeBeginEnd");
+			}
+
+			if (g_consume_trace_buffers
+				&& drain_mask == (iteration & drain_mask))
+			{
+				buffer.Drain([](const mage::TraceEvent&) noexcept {});
+			}
+		}
+
+		if (g_consume_trace_buffers)
+		{
+			buffer.Drain([](const mage::TraceEvent&) noexcept {});
+		}
+	}
+
+	MAGE_BENCHMARK(TraceScopeBeginEnd);
+
+	/**
+	 Sums the logarithms of the same range of integers as
+	 @c ParallelLogSum in an instrumented parallel loop, and writes the
+	 busy and wait times of each worker to the given output stream.
+
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		options
+					A reference to the parallel loop options.
+	 */
+	void ReportParallelLogSum(std::ostream& stream,
+							  const mage::ParallelForOptions& options)
+	{
+		constexpr std::int64_t count      = 1000000;
+		constexpr std::int64_t block_size = 1000;
+
+		// Each iteration sums a block of logarithms.
+		const auto statistics = mage::ParallelFor(0, count / block_size,
+			[](std::int64_t block)
+			{
+				double sum = 0.0;
+				for (auto i = block * block_size + 1;
+					 i <= (block + 1) * block_size; ++i)
+				{
+					sum += std::log(static_cast< double >(i));
+				}
+
+				mage::DoNotOptimize(sum);
+			},
+			options);
+
+		mage::WriteParallelReport(stream, statistics);
+	}
+
+	/**
+	 Converts the given binary trace file to the given output stream.
+
+	 @param[in]		fname
+					A pointer to the null-terminated path of the binary trace
+					file.
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @param[in]		summary
+					@c true to write a summary. @c false to write Chrome
+					Trace Event JSON.
+	 @return		The exit code.
+	 */
+	int ConvertBinaryTrace(const char* fname, std::ostream& stream,
+						   bool summary)
+	{
+		mage::BinaryTraceReader reader(fname);
+		if (!reader.IsOpen())
+		{
+			std::cerr << "Failed to read trace: " << fname << std::endl;
+			return 1;
+		}
+
+		const auto success = summary
+						   ? mage::WriteBinaryTraceSummary(stream, reader)
+						   : mage::WriteBinaryTraceAsChromeJson(stream, reader);
+		if (!success)
+		{
+			std::cerr << "Malformed trace: " << fname << std::endl;
+			return 1;
+		}
+
+		return 0;
+	}
+
+	/**
+	 Collects the given shared trace region to the given output stream.
+
+	 @param[in]		name
+					A pointer to the null-terminated name of the shared trace
+					region.
+	 @param[in,out]	stream
+					A reference to the output stream.
+	 @return		The exit code.
+	 */
+	int CollectSharedTrace(const char* name, std::ostream& stream)
+	{
+		mage::SharedTraceRegion region;
+		if (!region.Open(name))
+		{
+			std::cerr << "Failed to open shared trace: " << name << std::endl;
+			return 1;
+		}
+
+		mage::WriteSharedTraceAsChromeJson(stream, region.Collect());
+
+		if (const auto dropped_count = region.GetDroppedCount();
+			0u != dropped_count)
+		{
+			std::cerr << "Dropped events: " << dropped_count << std::endl;
+		}
+
+		return 0;
+	}
+
+	/**
+	 The flush period of binary trace writers.
+	 */
+	constexpr std::chrono::milliseconds g_binary_trace_flush_period(10);
+
+	/**
+	 The exit code of runs in which a benchmark regressed.
+	 */
+	constexpr int g_regression_exit_code = 2;
+}
+
+int main(int argc, char* argv[])
+{
+	mage::BenchmarkOptions options;
+	std::string_view filter;
+	const char* json_fname = nullptr;
+	const char* save_baseline_fname = nullptr;
+	const char* baseline_fname = nullptr;
+	mage::RegressionOptions regression_options;
+	mage::ParallelForOptions parallel_options;
+	bool parallel_report = false;
+	const char* sample_profile_fname = nullptr;
+	mage::U32 sample_frequency = 1000u;
+	const char* shared_trace_name = nullptr;
+	const char* binary_trace_fname = nullptr;
 
-	//  Perform some computation.
-	double sum = 0.0;
-	#pragma omp parallel for schedule(static, 1) reduction(+ : sum)
-	for (std::int64_t i = 0; i < 10000000000; ++i)
+	for (int i = 1; i < argc; ++i)
 	{
-		sum += std::log(static_cast< double >(i));
+		const std::string_view arg = argv[i];
+		const char* const value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+		if (nullptr == value)
+		{
+			std::cerr << "Missing value for argument: " << arg << std::endl;
+			return 1;
+		}
+
+		if ("--trace-summary" == arg)
+		{
+			return ConvertBinaryTrace(value, std::cout, true);
+		}
+		else if ("--trace-to-chrome" == arg)
+		{
+			return ConvertBinaryTrace(value, std::cout, false);
+		}
+		else if ("--collect-shared-trace" == arg)
+		{
+			return CollectSharedTrace(value, std::cout);
+		}
+		else if ("--remove-shared-trace" == arg)
+		{
+			return mage::SharedTraceRegion::Remove(value) ? 0 : 1;
+		}
+		else if ("--shared-trace" == arg)
+		{
+			shared_trace_name = value;
+		}
+		else if ("--binary-trace" == arg)
+		{
+			binary_trace_fname = value;
+		}
+		else if ("--filter" == arg)
+		{
+			filter = value;
+		}
+		else if ("--json" == arg)
+		{
+			json_fname = value;
+		}
+		else if ("--save-baseline" == arg)
+		{
+			save_baseline_fname = value;
+		}
+		else if ("--baseline" == arg)
+		{
+			baseline_fname = value;
+		}
+		else if ("--regression-threshold" == arg)
+		{
+			regression_options.m_threshold = std::strtod(value, nullptr);
+		}
+		else if ("--confidence" == arg)
+		{
+			regression_options.m_confidence = std::strtod(value, nullptr);
+		}
+		else if ("--compare-cpu-time" == arg)
+		{
+			regression_options.m_use_cpu_time = std::string_view("0") != value;
+		}
+		else if ("--parallel-report" == arg)
+		{
+			parallel_report = true;
+			parallel_options.m_backend
+				= ("threads" == std::string_view(value))
+				? mage::ParallelBackend::ThreadPool
+				: mage::ParallelBackend::OpenMP;
+		}
+		else if ("--schedule" == arg)
+		{
+			parallel_options.m_schedule
+				= ("dynamic" == std::string_view(value))
+				? mage::ParallelSchedule::Dynamic
+				: mage::ParallelSchedule::Static;
+		}
+		else if ("--chunk-size" == arg)
+		{
+			parallel_options.m_chunk_size
+				= static_cast< std::size_t >(std::strtoull(value, nullptr, 10));
+		}
+		else if ("--threads" == arg)
+		{
+			parallel_options.m_thread_count
+				= static_cast< std::size_t >(std::strtoull(value, nullptr, 10));
+		}
+		else if ("--sample-profile" == arg)
+		{
+			sample_profile_fname = value;
+		}
+		else if ("--sample-frequency" == arg)
+		{
+			sample_frequency
+				= static_cast< mage::U32 >(std::strtoul(value, nullptr, 10));
+		}
+		else if ("--min-time" == arg)
+		{
+			options.m_min_time = std::strtod(value, nullptr);
+		}
+		else if ("--warmup-time" == arg)
+		{
+			options.m_warmup_time = std::strtod(value, nullptr);
+		}
+		else if ("--repetitions" == arg)
+		{
+			options.m_repetition_count
+				= static_cast< std::size_t >(std::strtoull(value, nullptr, 10));
+		}
+		else
+		{
+			std::cerr << "Unknown argument: " << arg << std::endl;
+			return 1;
+		}
+
+		++i;
+	}
+
+	if (parallel_report)
+	{
+		ReportParallelLogSum(std::cout, parallel_options);
+		return 0;
+	}
+
+	// Reads the baseline before running the benchmarks to fail early.
+	std::vector< mage::BenchmarkResult > baseline;
+	if (nullptr != baseline_fname)
+	{
+		std::ifstream stream(baseline_fname);
+		if (!mage::ReadBaseline(stream, baseline))
+		{
+			std::cerr << "Failed to read baseline: " << baseline_fname
+					  << std::endl;
+			return 1;
+		}
+	}
+
+	if (nullptr != sample_profile_fname
+		&& !mage::StartSamplingProfiler(sample_frequency))
+	{
+		std::cerr << "Failed to start the sampling profiler" << std::endl;
+		return 1;
+	}
+
+	std::optional< mage::SharedTraceWriter > shared_trace;
+	if (nullptr != shared_trace_name)
+	{
+		shared_trace.emplace(shared_trace_name, true);
+		if (!shared_trace->IsOpen())
+		{
+			std::cerr << "Failed to join shared trace: " << shared_trace_name
+					  << std::endl;
+			return 1;
+		}
+
+		shared_trace->Begin("RunBenchmarks");
 	}
 
-	using mage::TimeIntervalSeconds;
+	std::optional< mage::BinaryTraceWriter > binary_trace;
+	if (nullptr != binary_trace_fname)
+	{
+		binary_trace.emplace(binary_trace_fname);
+		if (!binary_trace->IsOpen())
+		{
+			std::cerr << "Failed to create binary trace: "
+					  << binary_trace_fname << std::endl;
+			return 1;
+		}
 
-	const auto wall_clock_time 
-		= wall_clock_timer.DeltaTime< TimeIntervalSeconds >();
-	const auto cpu_time 
-		= cpu_timer.DeltaTime< TimeIntervalSeconds >();
+		// The binary trace writer becomes the only consumer of the trace
+		// buffers.
+		g_consume_trace_buffers = false;
+		binary_trace->StartBackgroundFlush(g_binary_trace_flush_period);
+	}
 
-	std::cout << "System Time = " << wall_clock_time.count() << std::endl;
-	std::cout << "Core   Time = " << cpu_time.count()        << std::endl;
+	std::vector< mage::BenchmarkResult > results;
+	{
+		MAGE_TRACE_SCOPE("RunBenchmarks");
+		results = mage::RunBenchmarks(options, filter);
+	}
+
+	// Flushes the remaining trace events and closes the binary trace.
+	binary_trace.reset();
+
+	if (shared_trace)
+	{
+		shared_trace->End("RunBenchmarks");
+	}
+	mage::WriteConsoleReport(std::cout, results);
+
+	if (nullptr != sample_profile_fname)
+	{
+		mage::StopSamplingProfiler();
+		const auto profile = mage::GetSamplingProfile();
+
+		std::cout << '\n';
+		mage::WriteSampledSymbolTable(std::cout, profile, 20u);
+
+		std::ofstream stream(sample_profile_fname);
+		mage::WriteFoldedStacks(stream, profile);
+		if (!stream)
+		{
+			std::cerr << "Failed to write: " << sample_profile_fname
+					  << std::endl;
+			return 1;
+		}
+	}
+
+	if (nullptr != json_fname)
+	{
+		std::ofstream stream(json_fname);
+		mage::WriteJsonReport(stream, results);
+		if (!stream)
+		{
+			std::cerr << "Failed to write: " << json_fname << std::endl;
+			return 1;
+		}
+	}
+
+	if (nullptr != save_baseline_fname)
+	{
+		std::ofstream stream(save_baseline_fname);
+		mage::WriteBaseline(stream, results);
+		if (!stream)
+		{
+			std::cerr << "Failed to write: " << save_baseline_fname
+					  << std::endl;
+			return 1;
+		}
+	}
+
+	if (nullptr != baseline_fname)
+	{
+		const auto comparisons
+			= mage::CompareBenchmarks(baseline, results, regression_options);
+		std::cout << '\n';
+		mage::WriteComparisonReport(std::cout, comparisons);
+
+		for (const auto& comparison : comparisons)
+		{
+			if (comparison.m_regression)
+			{
+				return g_regression_exit_code;
+			}
+		}
+	}
 
 	return 0;
 }